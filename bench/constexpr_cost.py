@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+spookの各関数を定数式で評価した時のコンパイル時コストを計測する
+
+各ケースについて、spook.hppをインクルードし式を1つだけconstexpr変数の初期化で評価する翻訳単位を生成し、
+  - 構文解析のみ（-fsyntax-only, /Zs）のコンパイル時間（式を含まない翻訳単位との差分）
+  - 評価に必要な定数式の操作数・ステップ数（コンパイラの上限オプションを二分探索して求める）
+を記録する。上限はコンパイラ毎に以下のオプションで探索する
+  - GCC   : -fconstexpr-ops-limit, -fconstexpr-loop-limit
+  - Clang : -fconstexpr-steps
+  - MSVC  : /constexpr:steps
+
+usage: constexpr_cost.py --compiler-id=gcc --include=DIR [options] -- <compiler command...>
+"""
+
+import argparse
+import concurrent.futures
+import csv
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+# (関数名, 式のテンプレート, 引数のリスト)
+# 引数は代表的な値と、反復回数が大きくなりやすい値（大きな値、特異点付近）を含める
+CASES = [
+    ('fabs',             'spook::fabs({})',              ['-2.5', '1.0e300']),
+    ('floor',            'spook::floor({})',             ['2.5', '-2.5', '1.0e15']),
+    ('ceil',             'spook::ceil({})',              ['2.5', '-2.5', '1.0e15']),
+    ('trunc',            'spook::trunc({})',             ['2.5', '-2.5', '1.0e15']),
+    ('round_to_nearest', 'spook::round_to_nearest({})',  ['2.5', '-3.5']),
+    ('fmod',             'spook::fmod({}, 3.0)',         ['6.3', '1.0e15']),
+    ('remainder',        'spook::remainder({}, 3.0)',    ['6.3', '1.0e15']),
+    ('sin',              'spook::sin({})',               ['0.5', '3.0', '1.0e2', '1.0e6', '1.0e22', '1.0e300', '0.5f', '0.5L', '1.0e300L']),
+    ('cos',              'spook::cos({})',               ['0.5', '3.0', '1.0e2', '1.0e6', '1.0e22', '1.0e300', '0.5f', '0.5L', '1.0e300L']),
+    ('tan',              'spook::tan({})',               ['0.5', '1.5', '1.0e2', '1.0e22']),
+    ('sincos',           'spook::sincos({})',            ['0.5', '3.0', '1.0e22']),
+    ('asin',             'spook::asin({})',              ['0.5', '0.9', '0.999']),
+    ('acos',             'spook::acos({})',              ['0.5', '0.9', '-0.999']),
+    ('atan',             'spook::atan({})',              ['0.5', '1.0', '1.0e3', '1.0e300']),
+    ('atan2',            'spook::atan2({}, 2.0)',        ['1.0', '-1.0e3', '1.0e300']),
+    ('ldexp',            'spook::ldexp({})',             ['1.5, -1074', '1.0e-310, 1000', '0.75f, -140', '1.0L, -16400']),
+    ('nextafter',        'spook::nextafter({})',         ['1.0, 0.0', '4.9e-324, 1.0', '1.0e-40f, 0.0f']),
+    ('ilogb',            'spook::ilogb({})',             ['1.0e300', '1.0e-310', '1.0e4000L']),
+    ('exp',              'spook::exp({})',               ['0.5', '1.0e1', '7.0e2', '-7.0e2', '0.5f', '0.5L']),
+    ('exp2',             'spook::exp2({})',              ['0.5', '1.0e3', '-1.07e3', '0.5f']),
+    ('exp10',            'spook::exp10({})',             ['0.5', '3.0e2', '0.5L']),
+    ('expm1',            'spook::expm1({})',             ['1.0e-10', '0.5', '-4.0e1', '0.5f']),
+    ('log',              'spook::log({})',               ['0.5', '2.0', '1.0e10', '1.0e300', '1.0e-300', '0.5f', '0.5L']),
+    ('log2',             'spook::log2({})',              ['0.5', '1.0e300', '0.5f']),
+    ('log10',            'spook::log10({})',             ['0.5', '1.0e300', '0.5L']),
+    ('log1p',            'spook::log1p({})',             ['1.0e-10', '0.5', '1.0e300', '0.5f']),
+    ('pow',              'spook::pow({})',               ['2.0, 10', '2.0, -10', '1.5, 1000000', '2.0, 0.5', '10.0, 300.0', '2.0f, 0.5']),
+    ('n_root',           'spook::n_root<5>({})',         ['2.0', '1.0e10', '1.0e-300']),
+    ('sqrt',             'spook::sqrt({})',              ['2.0', '1.0e10', '1.0e-10', '1.0e300', '4.9e-324', '2.0f', '2.0L']),
+    ('cbrt',             'spook::cbrt({})',              ['2.0', '1.0e10', '1.0e-10', '1.0e300', '2.0f']),
+    ('rsqrt',            'spook::rsqrt({})',             ['2.0', '1.0e-300', '2.0f']),
+    ('sin/fast',         'spook::sin({}, spook::fast)',  ['0.5', '1.0e22', '0.5L']),
+    ('sin/correctly_rounded', 'spook::sin({}, spook::correctly_rounded)', ['0.5', '1.0e22', '0.5f']),
+    ('exp/fast',         'spook::exp({}, spook::fast)',  ['0.5', '7.0e2', '0.5L']),
+    ('exp/correctly_rounded', 'spook::exp({}, spook::correctly_rounded)', ['0.5', '7.0e2', '0.5f']),
+    ('log/fast',         'spook::log({}, spook::fast)',  ['0.5', '1.0e300', '0.5L']),
+    ('log/correctly_rounded', 'spook::log({}, spook::correctly_rounded)', ['0.5', '1.0e300', '0.5f']),
+    ('pow/fast',         'spook::pow({}, spook::fast)',  ['2.0, 0.5', '10.0, 300.0']),
+    ('sqrt/fast',        'spook::sqrt({}, spook::fast)', ['2.0', '1.0e300']),
+    ('hypot',            'spook::hypot({})',             ['3.0, 4.0', '1.0e300, 1.0e300', '1.0e-310, 2.0e-310', '1.0, 2.0, 2.0', '3.0f, 4.0f']),
+    ('norm',             'spook::norm(std::array<double, 4>{{ {} }})', ['1.0, 2.0, 3.0, 4.0', '1.0e300, 1.0e300, 1.0e-300, 0.0']),
+    ('rnorm',            'spook::rnorm(std::array<double, 3>{{ {} }})', ['1.0, 2.0, 2.0', '1.0e-310, 0.0, 0.0']),
+    ('sinh',             'spook::sinh({})',              ['1.0e-10', '0.5', '1.0e2', '0.5f']),
+    ('cosh',             'spook::cosh({})',              ['0.5', '1.0e2', '0.5f']),
+    ('tanh',             'spook::tanh({})',              ['1.0e-10', '0.5', '1.0e2', '0.5f']),
+    ('asinh',            'spook::asinh({})',             ['0.5', '1.0e2', '1.0e300', '0.5f']),
+    ('acosh',            'spook::acosh({})',             ['1.5', '1.0e300', '1.5f']),
+    ('atanh',            'spook::atanh({})',             ['0.5', '0.999999', '0.5f']),
+    ('erf',              'spook::erf({})',               ['1.0e-10', '0.5', '2.0', '0.5f', '0.5L', '2.0L']),
+    ('erfc',             'spook::erfc({})',              ['0.3', '3.0', '2.5e1', '-2.0', '3.0f', '3.0L']),
+    ('tgamma',           'spook::tgamma({})',            ['0.5', '1.0e1', '1.705e2', '-2.5', '-1.705e2', '4.5f', '1.0e3L']),
+    ('lgamma',           'spook::lgamma({})',            ['0.3', '1.3', '1.0e1', '1.0e300', '-2.5', '0.5f', '0.5L']),
+    ('lerp',             'spook::lerp(0.0, 10.0, {})',   ['0.5']),
+    ('polar',            'spook::polar(1.0, {})',        ['0.5', '1.0e2']),
+    ('gcd',              'spook::gcd({})',               ['1071, 1029', '4611686018427387904ull, 1152921504606846976ull', '1.5, 0.25']),
+    ('lcm',              'spook::lcm({})',               ['1071, 1029', '1.5, 0.25']),
+    ('msb_pos',          'spook::msb_pos({})',           ['1u', '0xFFFFFFFFFFFFFFFFull']),
+    ('lsb_pos',          'spook::lsb_pos({})',           ['1u', '0x8000000000000000ull']),
+    ('popcount',         'spook::popcount({})',          ['0xFFu', '0xFFFFFFFFFFFFFFFFull']),
+    ('bit_reverse',      'spook::bit_reverse({})',       ['std::uint8_t(0x0Au)', '0xABCDEFABCDEFABCDull']),
+    ('countr_zero',      'spook::countr_zero({})',       ['8u', '0x8000000000000000ull']),
+    ('countl_zero',      'spook::countl_zero({})',       ['8u', '0x8000000000000000ull']),
+    ('ceil2',            'spook::ceil2({})',             ['5u', '0x4000000000000001ull']),
+    ('floor2',           'spook::floor2({})',            ['5u', '0xFFFFFFFFFFFFFFFFull']),
+]
+
+# 定数式評価の上限オプションとそのデフォルト値
+LIMITS = {
+    'gcc':   [('ops', '-fconstexpr-ops-limit={}', 2 ** 33), ('loop', '-fconstexpr-loop-limit={}', 262144)],
+    'clang': [('steps', '-fconstexpr-steps={}', 1048576)],
+    'msvc':  [('steps', '/constexpr:steps{}', 100000)],
+}
+
+# 上限超過を示す診断メッセージ
+LIMIT_ERROR = re.compile(r'.*(exceeds limit|maximum step limit|C3615|C2131).*')
+
+SYNTAX_ONLY = {
+    'gcc':   '-fsyntax-only',
+    'clang': '-fsyntax-only',
+    'msvc':  '/Zs',
+}
+
+SOURCE_TEMPLATE = '''#include "spook.hpp"
+
+constexpr auto spook_bench_result = {};
+'''
+
+
+class Compiler:
+    def __init__(self, cmd, compiler_id, include, cxxflags, workdir):
+        self.cmd = cmd
+        self.id = compiler_id
+        self.include = include
+        self.cxxflags = cxxflags
+        self.workdir = workdir
+        self.counter = 0
+
+    def include_flag(self):
+        return ('/I' if self.id == 'msvc' else '-I') + self.include
+
+    def write_source(self, expr):
+        self.counter += 1
+        path = os.path.join(self.workdir, 'case{}.cpp'.format(self.counter))
+        with open(path, 'w', encoding='utf-8') as f:
+            f.write(SOURCE_TEMPLATE.format(expr))
+        return path
+
+    def compile(self, source, extra=()):
+        """
+        構文解析のみのコンパイルを行い、（成功したか, 経過時間[s], 診断メッセージ）を返す
+        """
+        args = self.cmd + self.cxxflags + [self.include_flag(), SYNTAX_ONLY[self.id]] + list(extra) + [source]
+        start = time.perf_counter()
+        proc = subprocess.run(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, cwd=self.workdir)
+        elapsed = time.perf_counter() - start
+        return proc.returncode == 0, elapsed, proc.stdout.decode('utf-8', 'replace')
+
+
+def measure_time(compiler, source, repeat):
+    times = []
+    for _ in range(repeat):
+        ok, elapsed, log = compiler.compile(source)
+        if not ok:
+            return None, log
+        times.append(elapsed)
+    return statistics.median(times), ''
+
+
+def search_limit(compiler, source, flag, default, precision):
+    """
+    コンパイルが通る最小の上限値を探索する
+    @return 必要な操作数（precisionの相対精度の上界）
+    """
+    # 指数探索で[lo, hi)を得る、hiは成功する値
+    lo, hi = 0, 64
+    while hi < default:
+        ok, _, _ = compiler.compile(source, [flag.format(hi)])
+        if ok:
+            break
+        lo, hi = hi, hi * 8
+    else:
+        hi = default
+
+    # 二分探索で相対精度precisionまで詰める
+    while hi - lo > 1 and (hi - lo) > hi * precision:
+        mid = (lo + hi) // 2
+        ok, _, _ = compiler.compile(source, [flag.format(mid)])
+        if ok:
+            hi = mid
+        else:
+            lo = mid
+    return hi
+
+
+def run_case(compiler, name, expr, repeat, baseline):
+    source = compiler.write_source(expr)
+    elapsed, log = measure_time(compiler, source, repeat)
+
+    result = {
+        'function': name,
+        'expression': expr,
+        'status': 'ok',
+        'time_ms': None,
+    }
+
+    if elapsed is None:
+        # デフォルトの上限を超えた、あるいはその他のエラー
+        match = LIMIT_ERROR.search(log)
+        result['status'] = 'limit' if match else 'error'
+        result['message'] = match.group(0) if match else log.strip()[-200:]
+    else:
+        result['time_ms'] = round(max(elapsed - baseline, 0.0) * 1000.0, 3)
+
+    for key, _, default in LIMITS.get(compiler.id, []):
+        result[key] = None
+        result[key + '_limit'] = default
+        result[key + '_ratio'] = None
+
+    return result
+
+
+def expand_cases(pattern):
+    regex = re.compile(pattern) if pattern else None
+    for name, template, values in CASES:
+        if regex and not regex.search(name):
+            continue
+        for value in values:
+            yield name, template.format(value)
+
+
+def write_output(path, meta, results):
+    if path.endswith('.csv'):
+        keys = []
+        for r in results:
+            for k in r:
+                if k not in keys:
+                    keys.append(k)
+        with open(path, 'w', newline='', encoding='utf-8') as f:
+            writer = csv.DictWriter(f, fieldnames=keys)
+            writer.writeheader()
+            for r in results:
+                writer.writerow(r)
+    else:
+        with open(path, 'w', encoding='utf-8') as f:
+            json.dump(dict(meta, results=results), f, indent=2)
+
+
+def print_table(compiler_id, results):
+    keys = [key for key, _, _ in LIMITS.get(compiler_id, [])]
+    header = '{:<18} {:<58} {:>6} {:>10}'.format('function', 'expression', 'status', 'time[ms]')
+    for key in keys:
+        header += ' {:>12} {:>8}'.format(key, '%limit')
+    print(header)
+    for r in results:
+        line = '{:<18} {:<58} {:>6} {:>10}'.format(
+            r['function'], r['expression'][:58], r['status'],
+            '-' if r['time_ms'] is None else '{:.1f}'.format(r['time_ms']))
+        for key in keys:
+            count = r.get(key)
+            ratio = r.get(key + '_ratio')
+            line += ' {:>12} {:>8}'.format('-' if count is None else count,
+                                           '-' if ratio is None else '{:.3g}'.format(ratio * 100.0))
+        print(line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='measure compile-time cost of spook functions in constant expressions')
+    parser.add_argument('--compiler-id', required=True, choices=sorted(SYNTAX_ONLY.keys()))
+    parser.add_argument('--include', required=True, help='directory containing spook.hpp')
+    parser.add_argument('--cxxflag', action='append', default=[], help='additional compiler flag (repeatable)')
+    parser.add_argument('--output', default='constexpr_cost.json', help='result file (.json or .csv)')
+    parser.add_argument('--filter', default='', help='regex to select function names')
+    parser.add_argument('--repeat', type=int, default=3, help='compile count for timing (median is taken)')
+    parser.add_argument('--precision', type=float, default=0.01, help='relative precision of the limit search')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count() or 1, help='parallel jobs for the limit search')
+    parser.add_argument('--no-limits', action='store_true', help='only measure compile time')
+    parser.add_argument('command', nargs='+', help='compiler command')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory(prefix='spook_constexpr_cost') as workdir:
+        compiler = Compiler(args.command, args.compiler_id, os.path.abspath(args.include), args.cxxflag, workdir)
+
+        # 式を含まない翻訳単位の時間を基準とする
+        baseline, log = measure_time(compiler, compiler.write_source('0'), args.repeat)
+        if baseline is None:
+            sys.stderr.write(log)
+            return 1
+
+        cases = list(expand_cases(args.filter))
+
+        # 時間計測は逐次で行い、上限の探索のみ並列に行う
+        results = [run_case(compiler, name, expr, args.repeat, baseline) for name, expr in cases]
+
+        if not args.no_limits:
+            with concurrent.futures.ThreadPoolExecutor(max_workers=max(args.jobs, 1)) as pool:
+                futures = []
+                for r in results:
+                    if r['status'] != 'ok':
+                        futures.append(None)
+                        continue
+                    source = compiler.write_source(r['expression'])
+                    futures.append([(key, default, pool.submit(search_limit, compiler, source, flag, default, args.precision))
+                                    for key, flag, default in LIMITS.get(compiler.id, [])])
+                for r, fs in zip(results, futures):
+                    if fs is None:
+                        continue
+                    for key, default, future in fs:
+                        count = future.result()
+                        r[key] = count
+                        r[key + '_ratio'] = count / default
+
+        meta = {
+            'compiler_id': args.compiler_id,
+            'command': args.command + args.cxxflag,
+            'baseline_ms': round(baseline * 1000.0, 3),
+            'limits': {key: default for key, _, default in LIMITS.get(args.compiler_id, [])},
+        }
+        write_output(args.output, meta, results)
+        print_table(args.compiler_id, results)
+        print('\nresults written to {}'.format(os.path.abspath(args.output)))
+
+    failed = [r for r in results if r['status'] == 'error']
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,810 @@
+﻿#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+#include "spook.hpp"
+
+/**
+* spookの各関数の実行時スループットを対応するstd::の関数と比較する
+* usage: spook_bench [--output=FILE(.json|.csv)] [--filter=SUBSTR] [--samples=N] [--min-time=SEC]
+*/
+
+namespace spook_bench {
+
+	struct options {
+		std::string output = "spook_bench.json";
+		std::string filter{};
+		std::size_t samples = 1024;
+		double min_time = 0.05;
+	};
+
+	struct record {
+		const char* group;
+		const char* function;
+		const char* distribution;
+		const char* impl;
+		double ns_per_call;
+		std::size_t samples;
+	};
+
+	inline std::vector<record> records{};
+	inline options opt{};
+
+	/**
+	* @brief 計算結果を最適化で消されないようにする
+	*/
+	template<typename T>
+	void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile char sink;
+		sink = *reinterpret_cast<const volatile char*>(&value);
+#endif
+	}
+
+	template<typename T>
+	auto accumulate_value(const T& v) -> double {
+		if constexpr (std::is_arithmetic_v<T>) {
+			return double(v);
+		} else {
+			//std::complex
+			return double(v.real() + v.imag());
+		}
+	}
+
+	/**
+	* @brief passを繰り返し実行し、1要素当たりの時間[ns]を求める
+	* @param count 1回のpassで処理する要素数
+	*/
+	template<typename Pass>
+	auto measure_passes(Pass pass, std::size_t count) -> double {
+		using clock = std::chrono::steady_clock;
+
+		//ウォームアップ
+		pass();
+
+		std::size_t passes = 0;
+		const auto start = clock::now();
+		std::chrono::duration<double> elapsed{};
+
+		do {
+			pass();
+			++passes;
+			elapsed = clock::now() - start;
+		} while (elapsed.count() < opt.min_time);
+
+		return elapsed.count() * 1.0e9 / double(passes * count);
+	}
+
+	/**
+	* @brief 入力列に対してfを繰り返し適用し、1呼び出し当たりの時間[ns]を求める
+	*/
+	template<typename F, typename In>
+	auto measure(F f, const std::vector<In>& inputs) -> double {
+		auto pass = [&] {
+			double acc = 0.0;
+			for (const auto& x : inputs) {
+				if constexpr (std::is_arithmetic_v<In>) {
+					acc += accumulate_value(f(x));
+				} else {
+					acc += accumulate_value(f(x.first, x.second));
+				}
+			}
+			do_not_optimize(acc);
+		};
+
+		return measure_passes(pass, inputs.size());
+	}
+
+	inline auto selected(const char* function) -> bool {
+		return opt.filter.empty() || std::strstr(function, opt.filter.c_str()) != nullptr;
+	}
+
+	template<typename In, typename SpookF, typename StdF>
+	void run(const char* group, const char* function, const char* distribution, const std::vector<In>& inputs, SpookF spook_f, StdF std_f) {
+		const double spook_ns = measure(spook_f, inputs);
+		records.push_back({ group, function, distribution, "spook", spook_ns, inputs.size() });
+
+		if constexpr (!std::is_same_v<StdF, std::nullptr_t>) {
+			const double std_ns = measure(std_f, inputs);
+			records.push_back({ group, function, distribution, "std", std_ns, inputs.size() });
+			std::printf("%-8s %-18s %-16s %12.3f %12.3f %9.2fx\n", group, function, distribution, spook_ns, std_ns, spook_ns / std_ns);
+		} else {
+			std::printf("%-8s %-18s %-16s %12.3f %12s %10s\n", group, function, distribution, spook_ns, "-", "-");
+		}
+		std::fflush(stdout);
+	}
+
+	//入力分布
+	using engine = std::mt19937_64;
+	using generator = std::function<double(engine&)>;
+
+	inline auto uniform(double a, double b) -> generator {
+		return [=](engine& e) { return std::uniform_real_distribution<double>(a, b)(e); };
+	}
+
+	/**
+	* @brief 絶対値が[a, b]で対数一様に分布する値、signedなら符号もランダム
+	*/
+	inline auto log_uniform(double a, double b, bool is_signed = true) -> generator {
+		return [=](engine& e) {
+			double v = std::exp(std::uniform_real_distribution<double>(std::log(a), std::log(b))(e));
+			if (is_signed && (e() & 1u)) v = -v;
+			return v;
+		};
+	}
+
+	/**
+	* @brief 特異点（またはその周期的な繰り返し）の近傍の値
+	* @param origin, period origin + k * period (k = 0..count-1)の近傍を生成する
+	* @param width 特異点からの最大距離（相対）
+	*/
+	inline auto near(double origin, double period, int count, double width) -> generator {
+		return [=](engine& e) {
+			const double p = origin + period * double(std::uniform_int_distribution<int>(0, count - 1)(e));
+			const double d = std::uniform_real_distribution<double>(-width, width)(e);
+			return p + d * std::max(1.0, std::fabs(p));
+		};
+	}
+
+	struct distribution {
+		const char* name;
+		generator gen;
+		generator gen2 = nullptr;	//2引数関数の2つ目の引数
+	};
+
+	inline auto make_inputs(const generator& gen) -> std::vector<double> {
+		engine e{ 0x5EED };
+		std::vector<double> v(opt.samples);
+		for (auto& x : v) x = gen(e);
+		return v;
+	}
+
+	inline auto make_inputs(const generator& gen, const generator& gen2) -> std::vector<std::pair<double, double>> {
+		engine e{ 0x5EED };
+		std::vector<std::pair<double, double>> v(opt.samples);
+		for (auto& x : v) x = { gen(e), gen2(e) };
+		return v;
+	}
+
+	template<typename SpookF, typename StdF>
+	void unary(const char* function, std::initializer_list<distribution> dists, SpookF spook_f, StdF std_f) {
+		if (!selected(function)) return;
+
+		for (const auto& d : dists) {
+			run("cmath", function, d.name, make_inputs(d.gen), spook_f, std_f);
+		}
+	}
+
+	template<typename SpookF, typename StdF>
+	void binary(const char* function, std::initializer_list<distribution> dists, SpookF spook_f, StdF std_f) {
+		if (!selected(function)) return;
+
+		for (const auto& d : dists) {
+			run("cmath", function, d.name, make_inputs(d.gen, d.gen2), spook_f, std_f);
+		}
+	}
+
+	//整数の入力分布
+	using int_generator = std::function<std::uint64_t(engine&)>;
+
+	struct int_distribution {
+		const char* name;
+		int_generator gen;
+	};
+
+	inline auto int_distributions() -> std::vector<int_distribution> {
+		return {
+			{ "uniform", [](engine& e) { return e(); } },
+			{ "small", [](engine& e) { return e() & 0xFFu; } },
+			{ "huge", [](engine& e) { return e() | 0x8000000000000000ull; } },
+			//ゼロと2の冪
+			{ "near_singularity", [](engine& e) { return (e() & 7u) == 0u ? std::uint64_t(0) : std::uint64_t(1) << (e() & 63u); } },
+		};
+	}
+
+	template<typename SpookF, typename StdF>
+	void bits(const char* function, SpookF spook_f, StdF std_f) {
+		if (!selected(function)) return;
+
+		for (const auto& d : int_distributions()) {
+			engine e{ 0x5EED };
+			std::vector<std::uint64_t> v(opt.samples);
+			for (auto& x : v) x = d.gen(e);
+
+			run("bit", function, d.name, v, spook_f, std_f);
+		}
+	}
+
+	template<typename SpookF, typename StdF>
+	void numeric(const char* function, SpookF spook_f, StdF std_f) {
+		if (!selected(function)) return;
+
+		const std::pair<const char*, std::function<std::pair<std::uint64_t, std::uint64_t>(engine&)>> dists[] = {
+			//lcmがオーバーフローしないように、それぞれ32bitに収める
+			{ "uniform", [](engine& e) { return std::make_pair((e() >> 40) + 1u, (e() >> 40) + 1u); } },
+			{ "small", [](engine& e) { return std::make_pair(e() % 1000u + 1u, e() % 1000u + 1u); } },
+			{ "huge", [](engine& e) { return std::make_pair((e() >> 32) | 0x80000000u, (e() >> 32) | 0x80000000u); } },
+			//ユークリッドの互除法の最悪ケースである隣接するフィボナッチ数
+			{ "near_singularity", [](engine& e) {
+				std::uint64_t a = 1, b = 1;
+				for (auto n = 30u + (e() % 50u); n != 0; --n) {
+					auto t = a + b;
+					a = b;
+					b = t;
+				}
+				return std::make_pair(b, a);
+			} },
+		};
+
+		for (const auto& [name, gen] : dists) {
+			engine e{ 0x5EED };
+			std::vector<std::pair<std::uint64_t, std::uint64_t>> v(opt.samples);
+			for (auto& x : v) x = gen(e);
+
+			run("numeric", function, name, v, spook_f, std_f);
+		}
+	}
+
+#if defined(__cpp_lib_span) && defined(__cpp_lib_bit_cast)
+	/**
+	* @brief 配列全体をまとめて処理するspook::batchの関数と、std::の関数を要素毎に呼ぶループを比べる
+	* @param spook_f (x, y, out)を受け取る、1引数の関数はyを使わない
+	* @param std_f (x, y)を受け取る
+	*/
+	template<typename SpookF, typename StdF>
+	void batch(const char* function, std::initializer_list<distribution> dists, SpookF spook_f, StdF std_f) {
+		if (!selected(function)) return;
+
+		for (const auto& d : dists) {
+			const auto x = make_inputs(d.gen);
+			const auto y = d.gen2 ? make_inputs(d.gen2) : x;
+			std::vector<double> out(x.size());
+
+			const double spook_ns = measure_passes([&] { spook_f(std::span<const double>(x), std::span<const double>(y), std::span<double>(out)); do_not_optimize(out.data()); }, x.size());
+			const double std_ns = measure_passes([&] { for (std::size_t i = 0; i < x.size(); ++i) out[i] = std_f(x[i], y[i]); do_not_optimize(out.data()); }, x.size());
+
+			records.push_back({ "batch", function, d.name, "spook", spook_ns, x.size() });
+			records.push_back({ "batch", function, d.name, "std", std_ns, x.size() });
+			std::printf("%-8s %-18s %-16s %12.3f %12.3f %9.2fx\n", "batch", function, d.name, spook_ns, std_ns, spook_ns / std_ns);
+			std::fflush(stdout);
+		}
+	}
+#endif
+
+	inline void run_cmath() {
+		constexpr double pi = spook::pi<>;
+
+		const distribution rounding[] = {
+			{ "uniform", uniform(-100.0, 100.0) },
+			{ "small", log_uniform(1.0e-8, 1.0e-3) },
+			{ "huge", log_uniform(1.0e6, 1.0e18) },
+			{ "near_singularity", near(-8.5, 1.0, 16, 1.0e-12) },
+		};
+
+		auto rounding_dists = [&](const char* fn, auto spook_f, auto std_f) {
+			if (!selected(fn)) return;
+			for (const auto& d : rounding) run("cmath", fn, d.name, make_inputs(d.gen), spook_f, std_f);
+		};
+
+		rounding_dists("fabs", [](double x) { return spook::fabs(x); }, [](double x) { return std::fabs(x); });
+		rounding_dists("floor", [](double x) { return spook::floor(x); }, [](double x) { return std::floor(x); });
+		rounding_dists("ceil", [](double x) { return spook::ceil(x); }, [](double x) { return std::ceil(x); });
+		rounding_dists("trunc", [](double x) { return spook::trunc(x); }, [](double x) { return std::trunc(x); });
+		rounding_dists("round_to_nearest", [](double x) { return spook::round_to_nearest(x); }, [](double x) { return std::nearbyint(x); });
+
+		binary("fmod", {
+				{ "uniform", uniform(-100.0, 100.0), uniform(0.5, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3), log_uniform(1.0e-9, 1.0e-8, false) },
+				{ "huge", log_uniform(1.0e6, 1.0e15), uniform(0.5, 10.0) },
+				{ "near_singularity", near(-21.0, 3.0, 14, 1.0e-12), [](engine&) { return 3.0; } },
+			},
+			[](double x, double y) { return spook::fmod(x, y); }, [](double x, double y) { return std::fmod(x, y); });
+
+		binary("remainder", {
+				{ "uniform", uniform(-100.0, 100.0), uniform(0.5, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3), log_uniform(1.0e-9, 1.0e-8, false) },
+				{ "huge", log_uniform(1.0e6, 1.0e15), uniform(0.5, 10.0) },
+				{ "near_singularity", near(-19.5, 3.0, 14, 1.0e-12), [](engine&) { return 3.0; } },
+			},
+			[](double x, double y) { return spook::remainder(x, y); }, [](double x, double y) { return std::remainder(x, y); });
+
+		//sin, cosはpiの整数倍、tanはpi/2の奇数倍の近傍を特異点とする
+		unary("sin", {
+				{ "uniform", uniform(-2.0 * pi, 2.0 * pi) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e15) },
+				{ "near_singularity", near(-4.0 * pi, pi, 9, 1.0e-9) },
+			},
+			[](double x) { return spook::sin(x); }, [](double x) { return std::sin(x); });
+
+		unary("cos", {
+				{ "uniform", uniform(-2.0 * pi, 2.0 * pi) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e15) },
+				{ "near_singularity", near(-3.5 * pi, pi, 8, 1.0e-9) },
+			},
+			[](double x) { return spook::cos(x); }, [](double x) { return std::cos(x); });
+
+		unary("tan", {
+				{ "uniform", uniform(-0.5 * pi, 0.5 * pi) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e15) },
+				{ "near_singularity", near(-3.5 * pi, pi, 8, 1.0e-9) },
+			},
+			[](double x) { return spook::tan(x); }, [](double x) { return std::tan(x); });
+
+		//sin, cosの両方を使う場合との比較
+		unary("sincos", {
+				{ "uniform", uniform(-2.0 * pi, 2.0 * pi) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e15) },
+				{ "near_singularity", near(-4.0 * pi, pi, 9, 1.0e-9) },
+			},
+			[](double x) { const auto [s, c] = spook::sincos(x); return s + c; }, [](double x) { return std::sin(x) + std::cos(x); });
+
+		unary("polar", {
+				{ "uniform", uniform(-2.0 * pi, 2.0 * pi) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e15) },
+				{ "near_singularity", near(-4.0 * pi, 0.5 * pi, 17, 1.0e-9) },
+			},
+			[](double x) { return spook::polar(1.0, x); }, [](double x) { return std::polar(1.0, x); });
+
+		//asin, acosの定義域は有界なのでhugeは無い、特異点は±1の近傍
+		unary("asin", {
+				{ "uniform", uniform(-1.0, 1.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "near_singularity", log_uniform(0.99, 0.999) },
+			},
+			[](double x) { return spook::asin(x); }, [](double x) { return std::asin(x); });
+
+		unary("acos", {
+				{ "uniform", uniform(-1.0, 1.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "near_singularity", log_uniform(0.99, 0.999) },
+			},
+			[](double x) { return spook::acos(x); }, [](double x) { return std::acos(x); });
+
+		unary("atan", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e1, 1.0e300) },
+				{ "near_singularity", near(-1.0, 2.0, 2, 1.0e-9) },
+			},
+			[](double x) { return spook::atan(x); }, [](double x) { return std::atan(x); });
+
+		//atan2は負のx軸（分岐切断）の近傍を特異点とする
+		binary("atan2", {
+				{ "uniform", uniform(-10.0, 10.0), uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3), log_uniform(1.0e-4, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e300), log_uniform(1.0e6, 1.0e300) },
+				{ "near_singularity", log_uniform(1.0e-12, 1.0e-9), uniform(-10.0, -0.1) },
+			},
+			[](double y, double x) { return spook::atan2(y, x); }, [](double y, double x) { return std::atan2(y, x); });
+
+		//expはオーバーフロー・アンダーフローの境界付近を特異点とする
+		unary("exp", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 7.0e2) },
+				{ "near_singularity", near(-708.0, 1416.0, 2, 1.0e-3) },
+			},
+			[](double x) { return spook::exp(x); }, [](double x) { return std::exp(x); });
+
+		unary("exp2", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 1.0e3) },
+				{ "near_singularity", near(-1022.0, 2046.0, 2, 1.0e-3) },
+			},
+			[](double x) { return spook::exp2(x); }, [](double x) { return std::exp2(x); });
+
+		unary("exp10", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e1, 3.0e2) },
+				{ "near_singularity", near(-307.0, 615.0, 2, 1.0e-3) },
+			},
+			[](double x) { return spook::exp10(x); }, [](double x) { return std::pow(10.0, x); });
+
+		//expm1は0付近の桁落ちが問題になる
+		unary("expm1", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 7.0e2) },
+				{ "near_singularity", near(-1.0e-6, 2.0e-6, 2, 1.0e-7) },
+			},
+			[](double x) { return spook::expm1(x); }, [](double x) { return std::expm1(x); });
+
+		unary("log", {
+				{ "uniform", uniform(0.1, 10.0) },
+				{ "small", log_uniform(1.0e-4, 1.0e-2, false) },
+				{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+				{ "near_singularity", near(1.0, 0.0, 1, 1.0e-9) },
+			},
+			[](double x) { return spook::log(x); }, [](double x) { return std::log(x); });
+
+		unary("log2", {
+				{ "uniform", uniform(0.1, 10.0) },
+				{ "small", log_uniform(1.0e-300, 1.0e-2, false) },
+				{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+				{ "near_singularity", near(1.0, 0.0, 1, 1.0e-9) },
+			},
+			[](double x) { return spook::log2(x); }, [](double x) { return std::log2(x); });
+
+		unary("log10", {
+				{ "uniform", uniform(0.1, 10.0) },
+				{ "small", log_uniform(1.0e-300, 1.0e-2, false) },
+				{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+				{ "near_singularity", near(1.0, 0.0, 1, 1.0e-9) },
+			},
+			[](double x) { return spook::log10(x); }, [](double x) { return std::log10(x); });
+
+		//log1pは-1付近を特異点とする
+		unary("log1p", {
+				{ "uniform", uniform(-0.5, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+				{ "near_singularity", near(-0.999999, 0.0, 1, 1.0e-7) },
+			},
+			[](double x) { return spook::log1p(x); }, [](double x) { return std::log1p(x); });
+
+		binary("pow", {
+				{ "uniform", uniform(0.1, 10.0), uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-4, 1.0e-2, false), uniform(-10.0, 10.0) },
+				{ "huge", log_uniform(1.0e2, 1.0e4, false), uniform(-50.0, 50.0) },
+				{ "near_singularity", near(1.0, 0.0, 1, 1.0e-9), log_uniform(1.0e6, 1.0e9) },
+			},
+			[](double x, double y) { return spook::pow(x, y); }, [](double x, double y) { return std::pow(x, y); });
+
+		binary("pow(int)", {
+				{ "uniform", uniform(0.1, 10.0), [](engine& e) { return double(std::int64_t(e() % 21u) - 10); } },
+				{ "small", log_uniform(1.0e-4, 1.0e-2, false), [](engine& e) { return double(std::int64_t(e() % 21u) - 10); } },
+				{ "huge", uniform(0.5, 1.5), [](engine& e) { return double(e() % 1000000u); } },
+				{ "near_singularity", near(1.0, 0.0, 1, 1.0e-9), [](engine& e) { return double(e() % 1000000000u); } },
+			},
+			[](double x, double y) { return spook::pow(x, std::int64_t(y)); }, [](double x, double y) { return std::pow(x, int(y)); });
+
+		const std::initializer_list<distribution> root_dists = {
+			{ "uniform", uniform(0.0, 100.0) },
+			{ "small", log_uniform(1.0e-8, 1.0e-3, false) },
+			{ "huge", log_uniform(1.0e100, 1.0e300, false) },
+			{ "near_singularity", log_uniform(1.0e-300, 1.0e-200, false) },
+		};
+
+		unary("sqrt", root_dists, [](double x) { return spook::sqrt(x); }, [](double x) { return std::sqrt(x); });
+		unary("cbrt", root_dists, [](double x) { return spook::cbrt(x); }, [](double x) { return std::cbrt(x); });
+		unary("rsqrt", root_dists, [](double x) { return spook::rsqrt(x); }, [](double x) { return 1.0 / std::sqrt(x); });
+
+		//精度の方針を指定したもの、既定（faithful）との比較
+		const std::initializer_list<distribution> trig_policy_dists = {
+			{ "uniform", uniform(-2.0 * pi, 2.0 * pi) },
+			{ "huge", log_uniform(1.0e6, 1.0e15) },
+		};
+		const std::initializer_list<distribution> exp_policy_dists = {
+			{ "uniform", uniform(-10.0, 10.0) },
+			{ "huge", log_uniform(1.0e2, 7.0e2) },
+		};
+		const std::initializer_list<distribution> log_policy_dists = {
+			{ "uniform", uniform(0.1, 10.0) },
+			{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+		};
+
+		unary("sin/fast", trig_policy_dists, [](double x) { return spook::sin(x, spook::fast); }, [](double x) { return std::sin(x); });
+		unary("sin/correctly_rounded", trig_policy_dists, [](double x) { return spook::sin(x, spook::correctly_rounded); }, [](double x) { return std::sin(x); });
+		unary("exp/fast", exp_policy_dists, [](double x) { return spook::exp(x, spook::fast); }, [](double x) { return std::exp(x); });
+		unary("exp/correctly_rounded", exp_policy_dists, [](double x) { return spook::exp(x, spook::correctly_rounded); }, [](double x) { return std::exp(x); });
+		unary("log/fast", log_policy_dists, [](double x) { return spook::log(x, spook::fast); }, [](double x) { return std::log(x); });
+		unary("log/correctly_rounded", log_policy_dists, [](double x) { return spook::log(x, spook::correctly_rounded); }, [](double x) { return std::log(x); });
+		binary("pow/fast", {
+				{ "uniform", uniform(0.1, 10.0), uniform(-10.0, 10.0) },
+			},
+			[](double x, double y) { return spook::pow(x, y, spook::fast); }, [](double x, double y) { return std::pow(x, y); });
+		unary("sqrt/fast", root_dists, [](double x) { return spook::sqrt(x, spook::fast); }, [](double x) { return std::sqrt(x); });
+		unary("n_root<5>", root_dists, [](double x) { return spook::n_root<5>(x); }, [](double x) { return std::pow(x, 0.2); });
+
+		binary("hypot", {
+				{ "uniform", uniform(-100.0, 100.0), uniform(-100.0, 100.0) },
+				{ "small", log_uniform(1.0e-300, 1.0e-200), log_uniform(1.0e-300, 1.0e-200) },
+				{ "huge", log_uniform(1.0e200, 1.0e300), log_uniform(1.0e200, 1.0e300) },
+				{ "near_singularity", log_uniform(1.0e100, 1.0e300), log_uniform(1.0e-300, 1.0e-100) },
+			},
+			[](double x, double y) { return spook::hypot(x, y); }, [](double x, double y) { return std::hypot(x, y); });
+
+		binary("rnorm", {
+				{ "uniform", uniform(-100.0, 100.0), uniform(-100.0, 100.0) },
+				{ "small", log_uniform(1.0e-300, 1.0e-200), log_uniform(1.0e-300, 1.0e-200) },
+				{ "huge", log_uniform(1.0e200, 1.0e300), log_uniform(1.0e200, 1.0e300) },
+				{ "near_singularity", log_uniform(1.0e100, 1.0e300), log_uniform(1.0e-300, 1.0e-100) },
+			},
+			[](double x, double y) { return spook::rnorm(std::array<double, 2>{ x, y }); }, [](double x, double y) { return 1.0 / std::hypot(x, y); });
+
+		//sinh、tanh、asinhは0付近の桁落ちが問題になる
+		unary("sinh", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(2.0e1, 7.0e2) },
+				{ "near_singularity", near(0.0, 0.0, 1, 1.0e-6) },
+			},
+			[](double x) { return spook::sinh(x); }, [](double x) { return std::sinh(x); });
+
+		unary("cosh", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(2.0e1, 7.0e2) },
+				{ "near_singularity", near(0.0, 0.0, 1, 1.0e-6) },
+			},
+			[](double x) { return spook::cosh(x); }, [](double x) { return std::cosh(x); });
+
+		unary("tanh", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e1, 2.0e1) },
+				{ "near_singularity", near(0.0, 0.0, 1, 1.0e-6) },
+			},
+			[](double x) { return spook::tanh(x); }, [](double x) { return std::tanh(x); });
+
+		unary("asinh", {
+				{ "uniform", uniform(-10.0, 10.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 1.0e300) },
+				{ "near_singularity", near(0.0, 0.0, 1, 1.0e-6) },
+			},
+			[](double x) { return spook::asinh(x); }, [](double x) { return std::asinh(x); });
+
+		//acoshは1付近を特異点とする
+		unary("acosh", {
+				{ "uniform", uniform(1.0, 10.0) },
+				{ "small", near(1.0, 0.0, 1, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+				{ "near_singularity", [](engine& e) { return 1.0 + std::uniform_real_distribution<double>(0.0, 1.0e-9)(e); } },
+			},
+			[](double x) { return spook::acosh(x); }, [](double x) { return std::acosh(x); });
+
+		//atanhは±1付近を特異点とする
+		unary("atanh", {
+				{ "uniform", uniform(-0.99, 0.99) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", uniform(0.99, 0.999999) },
+				{ "near_singularity", near(-0.999999, 1.999998, 2, 1.0e-7) },
+			},
+			[](double x) { return spook::atanh(x); }, [](double x) { return std::atanh(x); });
+
+		//erf, erfcに特異点は無いので、近似を切り替える±1, 1/2の近傍を測る
+		unary("erf", {
+				{ "uniform", uniform(-4.0, 4.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(6.0, 1.0e300) },
+				{ "near_singularity", near(-1.0, 2.0, 2, 1.0e-6) },
+			},
+			[](double x) { return spook::erf(x); }, [](double x) { return std::erf(x); });
+
+		//erfcは正の側で急速に減衰する
+		unary("erfc", {
+				{ "uniform", uniform(-4.0, 4.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", uniform(6.0, 27.0) },
+				{ "near_singularity", near(-0.5, 1.0, 2, 1.0e-6) },
+			},
+			[](double x) { return spook::erfc(x); }, [](double x) { return std::erfc(x); });
+
+		//tgamma, lgammaは0と負の整数を極とする
+		unary("tgamma", {
+				{ "uniform", uniform(0.01, 30.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", uniform(30.0, 171.0) },
+				{ "near_singularity", near(-10.0, 1.0, 10, 1.0e-6) },
+			},
+			[](double x) { return spook::tgamma(x); }, [](double x) { return std::tgamma(x); });
+
+		unary("lgamma", {
+				{ "uniform", uniform(0.01, 30.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e2, 1.0e300, false) },
+				{ "near_singularity", near(-10.0, 1.0, 10, 1.0e-6) },
+			},
+			[](double x) { return spook::lgamma(x); }, [](double x) { return std::lgamma(x); });
+
+#ifdef __cpp_lib_interpolate
+		unary("lerp", {
+				{ "uniform", uniform(0.0, 1.0) },
+				{ "small", log_uniform(1.0e-8, 1.0e-3) },
+				{ "huge", log_uniform(1.0e6, 1.0e15) },
+				{ "near_singularity", near(0.0, 1.0, 2, 1.0e-12) },
+			},
+			[](double t) { return spook::lerp(-1.0, 3.0, t); }, [](double t) { return std::lerp(-1.0, 3.0, t); });
+#endif
+	}
+
+	inline void run_bit() {
+		using u64 = std::uint64_t;
+
+#ifdef __cpp_lib_bitops
+		bits("popcount", [](u64 x) { return spook::popcount(x); }, [](u64 x) { return std::popcount(x); });
+		bits("countr_zero", [](u64 x) { return spook::countr_zero(x); }, [](u64 x) { return std::countr_zero(x); });
+		bits("countl_zero", [](u64 x) { return spook::countl_zero(x); }, [](u64 x) { return std::countl_zero(x); });
+		bits("countr_one", [](u64 x) { return spook::countr_one(x); }, [](u64 x) { return std::countr_one(x); });
+		bits("countl_one", [](u64 x) { return spook::countl_one(x); }, [](u64 x) { return std::countl_one(x); });
+		bits("rotl", [](u64 x) { return spook::rotl(x, 13); }, [](u64 x) { return std::rotl(x, 13); });
+		bits("rotr", [](u64 x) { return spook::rotr(x, 13); }, [](u64 x) { return std::rotr(x, 13); });
+		//lsb_pos(x) == countr_zero(x) + 1 (x != 0)
+		bits("lsb_pos", [](u64 x) { return spook::lsb_pos(x); }, [](u64 x) { return x == 0 ? 0 : std::countr_zero(x) + 1; });
+#else
+		bits("popcount", [](u64 x) { return spook::popcount(x); }, nullptr);
+		bits("countr_zero", [](u64 x) { return spook::countr_zero(x); }, nullptr);
+		bits("countl_zero", [](u64 x) { return spook::countl_zero(x); }, nullptr);
+		bits("countr_one", [](u64 x) { return spook::countr_one(x); }, nullptr);
+		bits("countl_one", [](u64 x) { return spook::countl_one(x); }, nullptr);
+		bits("rotl", [](u64 x) { return spook::rotl(x, 13); }, nullptr);
+		bits("rotr", [](u64 x) { return spook::rotr(x, 13); }, nullptr);
+		bits("lsb_pos", [](u64 x) { return spook::lsb_pos(x); }, nullptr);
+#endif
+
+#ifdef __cpp_lib_int_pow2
+		//msb_pos(x) == log2p1(x) == bit_width(x)
+		bits("msb_pos", [](u64 x) { return spook::msb_pos(x); }, [](u64 x) { return int(std::bit_width(x)); });
+		bits("log2p1", [](u64 x) { return spook::log2p1(x); }, [](u64 x) { return u64(std::bit_width(x)); });
+		bits("is_pow2", [](u64 x) { return spook::is_pow2(x); }, [](u64 x) { return std::has_single_bit(x); });
+		bits("ceil2", [](u64 x) { return spook::ceil2(x >> 1); }, [](u64 x) { return std::bit_ceil(x >> 1); });
+		bits("floor2", [](u64 x) { return spook::floor2(x); }, [](u64 x) { return std::bit_floor(x); });
+#else
+		bits("msb_pos", [](u64 x) { return spook::msb_pos(x); }, nullptr);
+		bits("log2p1", [](u64 x) { return spook::log2p1(x); }, nullptr);
+		bits("is_pow2", [](u64 x) { return spook::is_pow2(x); }, nullptr);
+		bits("ceil2", [](u64 x) { return spook::ceil2(x >> 1); }, nullptr);
+		bits("floor2", [](u64 x) { return spook::floor2(x); }, nullptr);
+#endif
+
+		//std::に対応する関数は無い
+		bits("bit_reverse", [](u64 x) { return spook::bit_reverse(x); }, nullptr);
+	}
+
+	inline void run_numeric() {
+		using u64 = std::uint64_t;
+
+		numeric("gcd", [](u64 m, u64 n) { return spook::gcd(m, n); }, [](u64 m, u64 n) { return std::gcd(m, n); });
+		numeric("lcm", [](u64 m, u64 n) { return spook::lcm(m, n); }, [](u64 m, u64 n) { return std::lcm(m, n); });
+	}
+
+	inline void run_batch() {
+#if defined(__cpp_lib_span) && defined(__cpp_lib_bit_cast)
+		constexpr double pi = spook::pi<>;
+
+		//例外的な値を含まない、ベクトル化された経路のみを通る入力
+		batch("sin[]", { { "uniform", uniform(-pi, pi) }, { "huge", log_uniform(1.0e2, 1.0e5) } },
+			[](auto x, auto, auto out) { spook::batch::sin<double>(x, out); }, [](double x, double) { return std::sin(x); });
+		batch("cos[]", { { "uniform", uniform(-pi, pi) }, { "huge", log_uniform(1.0e2, 1.0e5) } },
+			[](auto x, auto, auto out) { spook::batch::cos<double>(x, out); }, [](double x, double) { return std::cos(x); });
+		batch("exp[]", { { "uniform", uniform(-10.0, 10.0) }, { "huge", log_uniform(1.0e2, 7.0e2) } },
+			[](auto x, auto, auto out) { spook::batch::exp<double>(x, out); }, [](double x, double) { return std::exp(x); });
+		batch("log[]", { { "uniform", uniform(0.1, 10.0) }, { "huge", log_uniform(1.0e2, 1.0e300, false) } },
+			[](auto x, auto, auto out) { spook::batch::log<double>(x, out); }, [](double x, double) { return std::log(x); });
+		batch("sqrt[]", { { "uniform", uniform(0.0, 100.0) } },
+			[](auto x, auto, auto out) { spook::batch::sqrt<double>(x, out); }, [](double x, double) { return std::sqrt(x); });
+		batch("pow[]", { { "uniform", uniform(0.1, 10.0), uniform(-10.0, 10.0) } },
+			[](auto x, auto y, auto out) { spook::batch::pow<double>(x, y, out); }, [](double x, double y) { return std::pow(x, y); });
+		batch("atan2[]", { { "uniform", uniform(-100.0, 100.0), uniform(-100.0, 100.0) } },
+			[](auto y, auto x, auto out) { spook::batch::atan2<double>(y, x, out); }, [](double y, double x) { return std::atan2(y, x); });
+#endif
+	}
+
+	inline void run_table() {
+		constexpr double pi = spook::pi<>;
+
+		//表はコンパイル時に作られ、実行時は添字計算と多項式の評価のみ
+		static constexpr spook::table_function<spook::sin<double>, 256, spook::cubic_hermite_t> sin_table(-pi, pi);
+		static constexpr spook::table_function<spook::exp<double>, 256, spook::cubic_hermite_t> exp_table(-10.0, 10.0);
+		static constexpr spook::table_function<[](double x) { return spook::atan(x); }, 512, spook::cubic_hermite_t> atan_table(-8.0, 8.0);
+
+		auto table = [&](const char* fn, const distribution& d, auto table_f, auto std_f) {
+			if (!selected(fn)) return;
+			run("table", fn, d.name, make_inputs(d.gen), table_f, std_f);
+		};
+
+		table("sin~", { "uniform", uniform(-pi, pi) }, [](double x) { return sin_table(x); }, [](double x) { return std::sin(x); });
+		table("exp~", { "uniform", uniform(-10.0, 10.0) }, [](double x) { return exp_table(x); }, [](double x) { return std::exp(x); });
+		table("atan~", { "uniform", uniform(-8.0, 8.0) }, [](double x) { return atan_table(x); }, [](double x) { return std::atan(x); });
+	}
+
+	inline void run_polynomial() {
+		constexpr double ln2 = 0.69314718055994530942;
+
+		//係数はコンパイル時にminimax_fitで求める
+		static constexpr auto exp_coeffs = spook::minimax_fit<11>(spook::exp<double>, 0.0, ln2);
+
+		auto poly = [&](const char* fn, auto poly_f) {
+			if (!selected(fn)) return;
+			run("polynomial", fn, "uniform", make_inputs(uniform(0.0, ln2)), poly_f, [](double x) { return std::exp(x); });
+		};
+
+		poly("horner", [](double x) { return spook::horner(exp_coeffs, x); });
+		poly("estrin", [](double x) { return spook::estrin(exp_coeffs, x); });
+		poly("compensated_horner", [](double x) { return spook::compensated_horner(exp_coeffs, x); });
+	}
+
+	inline void write_output() {
+		const bool csv = opt.output.size() >= 4 && opt.output.compare(opt.output.size() - 4, 4, ".csv") == 0;
+
+		std::FILE* fp = std::fopen(opt.output.c_str(), "w");
+		if (fp == nullptr) {
+			std::fprintf(stderr, "cannot open %s\n", opt.output.c_str());
+			std::exit(EXIT_FAILURE);
+		}
+
+		if (csv) {
+			std::fprintf(fp, "group,function,distribution,impl,ns_per_call,calls_per_sec,samples\n");
+			for (const auto& r : records) {
+				std::fprintf(fp, "%s,%s,%s,%s,%.6f,%.1f,%zu\n", r.group, r.function, r.distribution, r.impl, r.ns_per_call, 1.0e9 / r.ns_per_call, r.samples);
+			}
+		} else {
+			std::fprintf(fp, "{\n  \"samples\": %zu,\n  \"min_time\": %g,\n  \"results\": [\n", opt.samples, opt.min_time);
+			for (std::size_t i = 0; i < records.size(); ++i) {
+				const auto& r = records[i];
+				std::fprintf(fp, "    {\"group\": \"%s\", \"function\": \"%s\", \"distribution\": \"%s\", \"impl\": \"%s\", \"ns_per_call\": %.6f, \"calls_per_sec\": %.1f, \"samples\": %zu}%s\n",
+					r.group, r.function, r.distribution, r.impl, r.ns_per_call, 1.0e9 / r.ns_per_call, r.samples, (i + 1 == records.size()) ? "" : ",");
+			}
+			std::fprintf(fp, "  ]\n}\n");
+		}
+
+		std::fclose(fp);
+		std::printf("\nresults written to %s\n", opt.output.c_str());
+	}
+
+	inline void parse_args(int argc, char* argv[]) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string arg = argv[i];
+			const auto value = [&](const char* key) -> const char* {
+				const auto len = std::strlen(key);
+				return arg.compare(0, len, key) == 0 ? argv[i] + len : nullptr;
+			};
+
+			if (auto v = value("--output=")) {
+				opt.output = v;
+			} else if (auto v = value("--filter=")) {
+				opt.filter = v;
+			} else if (auto v = value("--samples=")) {
+				opt.samples = std::max<std::size_t>(1, std::strtoull(v, nullptr, 10));
+			} else if (auto v = value("--min-time=")) {
+				opt.min_time = std::strtod(v, nullptr);
+			} else {
+				std::fprintf(stderr, "usage: %s [--output=FILE(.json|.csv)] [--filter=SUBSTR] [--samples=N] [--min-time=SEC]\n", argv[0]);
+				std::exit(EXIT_FAILURE);
+			}
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	using namespace spook_bench;
+
+	parse_args(argc, argv);
+
+	std::printf("%-8s %-18s %-16s %12s %12s %10s\n", "group", "function", "distribution", "spook[ns]", "std[ns]", "ratio");
+
+	run_cmath();
+	run_bit();
+	run_numeric();
+	run_batch();
+	run_table();
+	run_polynomial();
+
+	write_output();
+}
@@ -1,10 +1,22 @@
 ﻿#pragma once
 
 #include <limits>
+#include <array>
 #include <utility>
 #include <complex>
 #include <type_traits>
+#include <tuple>
 #include <cstdint>
+#include <climits>
+#include <cmath>
+
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+#if __has_include(<span>)
+#include <span>
+#endif
 
 #define SPOOK_NOT_USE_CONSTEVAL
 
@@ -18,6 +30,43 @@
 
 #endif // SPOOK_NOT_USE_CONSTEVAL
 
+//定数式の評価中かどうか。実行時の組み込み浮動小数点型では、結果が一意に定まる関数を<cmath>（ハードウェア命令）に任せる
+//判定できない処理系では常に定数式向けの実装を使う
+#if defined(__cpp_lib_is_constant_evaluated)
+
+#define SPOOK_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+
+#define SPOOK_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+
+#else
+
+#define SPOOK_IS_CONSTANT_EVALUATED() true
+
+#endif
+#else
+
+#define SPOOK_IS_CONSTANT_EVALUATED() true
+
+#endif // __cpp_lib_is_constant_evaluated
+
+//batchの要素毎の処理をループ内に展開させ、自動ベクトル化の対象にする
+#if defined(__GNUC__)
+
+#define SPOOK_FORCE_INLINE [[gnu::always_inline]] inline
+
+#elif defined(_MSC_VER)
+
+#define SPOOK_FORCE_INLINE __forceinline
+
+#else
+
+#define SPOOK_FORCE_INLINE inline
+
+#endif // __GNUC__
+
 
 namespace spook {
 	inline namespace customization_points {
@@ -76,7 +125,7 @@ namespace spook {
 	inline namespace concepts {
 
 		template<typename T>
-		concept integral = spook::is_integral_v<T>::value;
+		concept integral = spook::is_integral_v<T>;
 
 		template<typename T>
 		concept floating_point = spook::is_floating_point<T>::value;
@@ -145,6 +194,18 @@ namespace spook {
 	}
 }
 
+namespace spook {
+	inline namespace double_double {
+
+		//前方宣言
+		template<typename T>
+		struct dd;
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto sqrt(dd<T> x) -> dd<T>;
+	}
+}
+
 namespace spook {
 	inline namespace cmath {
 		inline namespace constant {
@@ -196,6 +257,120 @@ namespace spook {
 			}
 		}
 
+		inline namespace policy {
+
+			/**
+			* @brief 精度よりも速度を優先する
+			* @detail floatより広い型では単精度相当（相対誤差 2^-23程度）、float以下では桁数の半分（floatで相対誤差 2^-11程度）の
+			*         小さな多項式とニュートン法の回数で計算する
+			*/
+			struct fast_t {
+				explicit fast_t() = default;
+			};
+
+			/**
+			* @brief 誤差1ulp未満で計算する（既定）
+			*/
+			struct faithful_t {
+				explicit faithful_t() = default;
+			};
+
+			/**
+			* @brief より広い型（floatはdouble、それ以外はspook::dd<T>）で計算してから丸める
+			* @detail floatはdoubleでの値の誤差の範囲が丸めの境界を跨ぐ時だけdd<double>で計算し直すので、正しく丸められる
+			*         （整数乗のpowを除く。全入力をtest/spook_ulp.cppで確かめられる）。
+			*         doubleはdd<double>（相対誤差 2^-100程度）で計算して丸めるだけなので、真の値が丸めの境界にそれより近い場合は
+			*         誤って丸めることがあり、正しい丸めは保証しない（ほぼ正しい丸め）。組み込み型以外ではfaithful_tと同じ
+			*         double以上ではdd<T>の演算になるため、定数式での1回の評価はfaithful_tの数十倍重い
+			*         （GCCの演算回数でsinが約2.7万、expが約8万、logが約11万、powが約15万、faithful_tは数千）。
+			*         既定の-fconstexpr-ops-limit（2^25）ではsin/exp/logの256要素、powの200要素程度の表が上限なので、
+			*         それより大きな表は上限を引き上げるかfaithful_tを使うこと
+			*/
+			struct correctly_rounded_t {
+				explicit correctly_rounded_t() = default;
+			};
+
+			inline constexpr fast_t fast{};
+			inline constexpr faithful_t faithful{};
+			inline constexpr correctly_rounded_t correctly_rounded{};
+
+			/**
+			* @brief 精度の方針を表す型かを調べる
+			*/
+			template<typename Policy>
+			struct is_accuracy_policy : std::disjunction<
+				std::is_same<Policy, fast_t>,
+				std::is_same<Policy, faithful_t>,
+				std::is_same<Policy, correctly_rounded_t>
+			> {};
+
+			template<typename Policy>
+			inline constexpr bool is_accuracy_policy_v = is_accuracy_policy<Policy>::value;
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 方針に応じて、多項式やニュートン法の反復を選ぶ仮数部の桁数
+			* @detail fast_tはfloatより広い型では単精度相当の24ビット、float以下では桁数の半分（floatで12ビット）
+			*/
+			template<typename T, typename Policy>
+			inline constexpr int kernel_digits = spook::numeric_limits_traits<T>::digits;
+
+			template<typename T>
+			inline constexpr int kernel_digits<T, fast_t> = (24 < spook::numeric_limits_traits<T>::digits) ? 24 : (spook::numeric_limits_traits<T>::digits + 1) / 2;
+
+			/**
+			* @brief correctly_rounded_tで計算に使う型
+			* @detail floatは桁数が2倍以上あり指数部も広いdouble、それ以外はdd<T>
+			*/
+			template<typename T>
+			struct rounding_type {
+				using type = double_double::dd<T>;
+			};
+
+			template<>
+			struct rounding_type<float> {
+				using type = double;
+			};
+
+			/**
+			* @brief 広い型で計算してから丸めるか
+			*/
+			template<typename T, typename Policy>
+			inline constexpr bool use_rounding_type = std::is_same_v<Policy, correctly_rounded_t> && std::is_floating_point_v<T>;
+
+			/**
+			* @brief 方針に応じて計算に使う型
+			*/
+			template<typename T, typename Policy>
+			using evaluation_t = std::conditional_t<use_rounding_type<T, Policy>, typename rounding_type<T>::type, T>;
+
+			/**
+			* @brief 無限大、NaN、ゼロを特別に扱うか
+			* @detail IEEE 754の型に加えて、spook::dd<T>のように無限大とNaNを持つ型も含む
+			*/
+			template<typename T>
+			inline constexpr bool has_special_values = spook::numeric_limits_traits<T>::is_iec559
+				|| (spook::numeric_limits_traits<T>::has_infinity && spook::numeric_limits_traits<T>::has_quiet_NaN);
+
+			/**
+			* @brief 高速なfma命令が使えるか
+			*/
+			template<typename T>
+			inline constexpr bool has_fast_fma =
+#ifdef FP_FAST_FMAF
+				std::is_same_v<T, float> ||
+#endif
+#ifdef FP_FAST_FMA
+				std::is_same_v<T, double> ||
+#endif
+#ifdef FP_FAST_FMAL
+				std::is_same_v<T, long double> ||
+#endif
+				false;
+		}
+
 		//前方宣言
 		template <typename T>
 		SPOOK_CONSTEVAL auto signbit(T x) -> bool;
@@ -284,7 +459,11 @@ namespace spook {
 
 		template <typename T CONCEPT_FALLBACK_REDECL(concepts::floating_point<T, enabler<spook::is_floating_point<T>>)>
 		SPOOK_CONSTEVAL auto fabs(T x) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::fabs(x);
+			}
+
+			if (detail::has_special_values<T>) {
 				if (spook::iszero(x)) return T(+0.0);
 			}
 
@@ -310,7 +489,11 @@ namespace spook {
 				return x;
 			}
 
-			if (spook::numeric_limits_traits<T>::is_iec559) {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::ceil(x);
+			}
+
+			if (detail::has_special_values<T>) {
 				if (x == 0.0) return x;
 				if (spook::isinf(x)) return x;
 			}
@@ -331,7 +514,11 @@ namespace spook {
 				return x;
 			}
 
-			if (spook::numeric_limits_traits<T>::is_iec559) {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::floor(x);
+			}
+
+			if (detail::has_special_values<T>) {
 				if (x == 0.0) return x;
 				if (spook::isinf(x)) return x;
 			}
@@ -348,6 +535,10 @@ namespace spook {
 
 		template<typename T>
 		SPOOK_CONSTEVAL auto trunc(T x) -> T {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::trunc(x);
+			}
+
 			if (spook::signbit(x)) {
 				return spook::ceil(x);
 			}
@@ -377,955 +568,7209 @@ namespace spook {
 			return rounded;
 		}
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto remainder(T x, T y) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (spook::iszero(y) || spook::isinf(x) || spook::isnan(x) || spook::isnan(y)) {
-					return spook::numeric_limits_traits<T>::quiet_NaN();
+		namespace detail {
+
+			/**
+			* @brief x * 2^kを計算する
+			* @detail 定数式でも使えるよう、乗算のみで計算する
+			* @param x 仮数
+			* @param k 指数
+			* @return x * 2^k
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto scale2(T x, int k) -> T {
+				//2^kそのものが表現できない時は2回に分ける
+				if (spook::numeric_limits_traits<T>::max_exponent - 2 < k || k < spook::numeric_limits_traits<T>::min_exponent) {
+					return detail::scale2(detail::scale2(x, k / 2), k - k / 2);
 				}
+
+				T base = (k < 0) ? T(0.5) : T(2.0);
+				unsigned int n = (k < 0) ? unsigned(-k) : unsigned(k);
+
+				while (true) {
+					if (n & 1u) x *= base;
+					n >>= 1;
+					//不要な自乗によるオーバーフローを避ける
+					if (n == 0) break;
+					base *= base;
+				}
+
+				return x;
 			}
 
-			auto n = spook::round_to_nearest(x / y);
+			/**
+			* @brief 正の有限値xを、x = m * 2^eとなる[1, 2)の仮数mと指数eに分解する
+			* @detail ビット表現を介さずに、2の累乗による乗除算のみで分解する（非正規化数も可）
+			* @param x 正の有限値
+			* @return {仮数m, 指数e}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto split_exponent(T x) -> std::pair<T, int> {
+				using limits = spook::numeric_limits_traits<T>;
+
+				//2^(2^j)とその逆数の表、2^(2^j) < 2^max_exponentの範囲
+				T scales[16]{};
+				T inverses[16]{};
+				int count = 0;
+				for (T s = T(2.0), r = T(0.5); count < 16; s *= s, r *= r) {
+					scales[count] = s;
+					inverses[count] = r;
+					++count;
+					if (limits::max_exponent <= (1 << count)) break;
+				}
 
-			return x - n * y;
-		}
+				int e = 0;
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto fmod(T x, T y) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				bool y_is_zero = spook::iszero(y);
+				//非正規化数は表の範囲に収まらないので先に正規化数にしておく
+				if (x < (limits::min)()) {
+					x *= detail::scale2(T(1.0), limits::digits);
+					e -= limits::digits;
+				}
 
-				if (!y_is_zero && spook::iszero(x)) return x;
-				if (spook::isinf(x) || y_is_zero || spook::isnan(x) || spook::isnan(y)) {
-					return spook::numeric_limits_traits<T>::quiet_NaN();
+				for (int j = count - 1; 0 <= j; --j) {
+					if (scales[j] <= x) {
+						x *= inverses[j];
+						e += 1 << j;
+					}
 				}
-				else {
-					//xが有限であり、yが±∞であるとき
-					if (spook::isinf(y)) return x;
+				for (int j = count - 1; 0 <= j; --j) {
+					if (x * scales[j] < T(2.0)) {
+						x *= scales[j];
+						e -= 1 << j;
+					}
 				}
+
+				return { x, e };
 			}
 
-			auto n = spook::trunc(x / y);
+			/**
+			* @brief 浮動小数点数のビット表現を直接読み書きするための情報
+			* @detail IEEE754のbinary32、binary64とx87の80bit拡張倍精度について、std::bit_castで指数部を扱う
+			* @detail それ以外の型（numeric_limits_traitsでアダプトした型を含む）はavailable == falseとなり、算術演算で計算する
+			*/
+			template<typename T, typename = void>
+			struct float_layout {
+				static constexpr bool available = false;
+			};
 
-			return x - n * y;
-		}
+#ifdef __cpp_lib_bit_cast
 
-		namespace detail {
-			
 			/**
-			* @brief 三角関数の入力を[0, pi]の範囲に収める
-			* @param theta θ[rad]
-			* @return {[0, pi]に収めたθ, 象限の情報（piの奇数倍の時true）}
+			* @brief IEEE754の2進形式（符号、指数部、ケチ表現の仮数部）
+			* @tparam Bits 同じ大きさの符号なし整数型
 			*/
-			template<typename T>
-			SPOOK_CONSTEVAL auto reduce_theta(T theta) -> std::pair<T, bool> {
-				auto x = spook::fabs(theta);
-
-				if (0.0 <= x && x < constant::pi<T>) {
-					//ごちゃごちゃ計算する必要はない
-					return { x, false };
+			template<typename T, typename Bits>
+			struct ieee754_layout {
+				static constexpr bool available = true;
+
+				static constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+				static constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+				static constexpr Bits exponent_mask = Bits((std::numeric_limits<T>::max_exponent << 1) - 1) << mantissa_bits;
+
+				/**
+				* @brief バイアスされたままの指数部を取り出す
+				*/
+				static constexpr auto exponent(T x) -> int {
+					return int((std::bit_cast<Bits>(x) & exponent_mask) >> mantissa_bits);
 				}
 
-				//実質的にはこれ、ただし商も欲しかったので展開している
-				//spook::fmod(spook::fabs(theta), constant::pi<T>);
-
-				auto n = spook::trunc(spook::fabs(x) / constant::pi<T>);
-				auto r = x - n * constant::pi<T>;
-				if (spook::signbit(r)) r += constant::pi<T>;
+				/**
+				* @brief 符号と仮数部はそのままに、指数部をeに置き換える
+				* @param e バイアスされた指数、[1, 2 * bias]であること
+				*/
+				static constexpr auto with_exponent(T x, int e) -> T {
+					return std::bit_cast<T>((std::bit_cast<Bits>(x) & ~exponent_mask) | (Bits(e) << mantissa_bits));
+				}
 
-				//象限の情報を得る、余りがゼロということはpiの整数倍の時
-				//bool isodd = (r == 0.0) ? false : spook::fmod(n, T(2.0)) == T(1.0);
+				/**
+				* @brief 2^nを作る
+				* @param n 正規化数の指数の範囲であること
+				*/
+				static constexpr auto pow2(int n) -> T {
+					return std::bit_cast<T>(Bits(n + bias) << mantissa_bits);
+				}
 
-				//[0, pi]に押し込めた数と象限の情報
-				return { r, spook::fmod(n, T(2.0)) == T(1.0) };
-			}
-		}
+				/**
+				* @brief 符号ビットが立っているか
+				*/
+				static constexpr auto sign(T x) -> bool {
+					return (std::bit_cast<Bits>(x) >> (sizeof(Bits) * CHAR_BIT - 1)) != 0;
+				}
+			};
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto sin(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (arg == 0.0) return arg;
-				if (spook::isinf(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
-				if (spook::isnan(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
-			}
+			//binary32
+			template<typename T>
+			struct float_layout<T, std::enable_if_t<std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && std::numeric_limits<T>::digits == 24 && sizeof(T) == sizeof(std::uint32_t)>>
+				: ieee754_layout<T, std::uint32_t> {};
 
-			auto [theta, isodd] = detail::reduce_theta(arg);
+			//binary64（long doubleがdoubleと同じ環境を含む）
+			template<typename T>
+			struct float_layout<T, std::enable_if_t<std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && std::numeric_limits<T>::digits == 53 && sizeof(T) == sizeof(std::uint64_t)>>
+				: ieee754_layout<T, std::uint64_t> {};
 
-			//piの整数倍の時
-			if (theta == 0.0) return 0.0;
+			/**
+			* @brief x87の80bit拡張倍精度のビット表現（仮数部は整数ビットを明示的に持つ）
+			* @tparam Size 詰め物を含めた大きさ
+			*/
+			template<std::size_t Size>
+			struct x87_extended_bits {
+				std::uint64_t mantissa;
+				std::uint16_t sign_exponent;
+				unsigned char padding[Size - 10];
+			};
 
-			T x_sq = -(theta * theta);
-			T series = theta;
-			T tmp = theta;
-			T fact = T(2.0);
-			T r{};  //積み残し
-			T t{};  //級数和の一時変数
+			//x87 80bit拡張倍精度（リトルエンディアン、12byteか16byteに詰め物がある）
+			template<typename T>
+			struct float_layout<T, std::enable_if_t<std::is_same_v<T, long double> && std::numeric_limits<T>::digits == 64 && std::numeric_limits<T>::max_exponent == 16384 && 10 < sizeof(T)>> {
+				static constexpr bool available = true;
 
-			//マクローリン級数の計算
-			do {
-				tmp *= x_sq / (fact * (fact + T(1.0)));
-				t = series + (tmp + r);
-				r = (tmp + r) - (t - series);
-				series = t;
-				//series += tmp;
-				fact += T(2.0);
-			} while (spook::fabs(tmp) >= spook::numeric_limits_traits<T>::epsilon());
+				using bits_type = x87_extended_bits<sizeof(T)>;
 
-			series = isodd ? -series : series;
-			return spook::signbit(arg) ? -series : series;
-		}
+				static constexpr int bias = 16383;
 
+				static constexpr auto exponent(T x) -> int {
+					return int(std::bit_cast<bits_type>(x).sign_exponent & 0x7FFFu);
+				}
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto cos(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (arg == 0.0) return 1.0;
-				if (spook::isinf(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
-				if (spook::isnan(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
-			}
+				static constexpr auto with_exponent(T x, int e) -> T {
+					auto bits = std::bit_cast<bits_type>(x);
+					bits.sign_exponent = std::uint16_t((bits.sign_exponent & 0x8000u) | unsigned(e));
+					return std::bit_cast<T>(bits);
+				}
 
-			auto [theta, isodd] = detail::reduce_theta(arg);
+				static constexpr auto pow2(int n) -> T {
+					return std::bit_cast<T>(bits_type{ std::uint64_t(1) << 63, std::uint16_t(n + bias), {} });
+				}
 
-			//pi/2の整数倍の時
-			if (theta == 0.5 * constant::pi<T>) return 0.0;
+				static constexpr auto sign(T x) -> bool {
+					return (std::bit_cast<bits_type>(x).sign_exponent & 0x8000u) != 0;
+				}
+			};
 
-			T x_sq = -(theta * theta);
-			T series = T(1.0);
-			T tmp = T(1.0);
-			T fact = T(1.0);
-			T r{};  //積み残し
-			T t{};  //級数和の一時変数
+#endif // __cpp_lib_bit_cast
 
-			//マクローリン級数の計算
-			do {
-				tmp *= x_sq / (fact * (fact + T(1.0)));
-				t = series + (tmp + r);
-				r = (tmp + r) - (t - series);
-				series = t;
-				fact += T(2.0);
-			} while (spook::fabs(tmp) >= spook::numeric_limits_traits<T>::epsilon());
+			/**
+			* @brief 2^nを作る
+			* @param n [min_exponent - 1, max_exponent - 1]、正規化数の指数の範囲であること
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto pow2(int n) -> T {
+				if constexpr (float_layout<T>::available) {
+					return float_layout<T>::pow2(n);
+				} else {
+					return detail::scale2(T(1.0), n);
+				}
+			}
 
-			series = isodd ? -series : series;
-			return series;
+			/**
+			* @brief 符号ビットが立っているか（-0.0も真）
+			* @detail ビット表現の分からない型は、実行時はstd::signbit、定数式ではx < 0で代用する
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto sign_bit(T x) -> bool {
+				if constexpr (float_layout<T>::available) {
+					return float_layout<T>::sign(x);
+				} else {
+					if constexpr (std::is_floating_point_v<T>) {
+						if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::signbit(x);
+					}
+					return x < T(0.0);
+				}
+			}
 		}
 
+		/**
+		* @brief xを[0.5, 1)の仮数と2の冪に分解する
+		* @param x 分解する値
+		* @param exp 指数の格納先、0と∞とNaNの時は0
+		* @return x = 仮数 * 2^(*exp)となる仮数、0と∞とNaNの時はxそのもの
+		*/
 		template<typename T>
-		SPOOK_CONSTEVAL auto tan(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (arg == 0.0) return arg;
-				if (spook::isinf(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
-				if (spook::isnan(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+		SPOOK_CONSTEVAL auto frexp(T x, int* exp) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::frexp(x, exp);
 			}
 
-			auto[theta, isodd] = detail::reduce_theta(arg);
+			*exp = 0;
+			if (x == T(0.0) || spook::isinf(x) || spook::isnan(x)) return x;
 
-			//pi/2の整数倍の時
-			if (theta == 0.5 * constant::pi<T>) return spook::numeric_limits_traits<T>::infinity();
+			if constexpr (detail::float_layout<T>::available) {
+				using layout = detail::float_layout<T>;
 
-			auto sin_v = spook::sin(theta);
-			auto cos_v = spook::cos(theta);
+				int e = layout::exponent(x);
+
+				//非正規化数は正規化数にしてから読む
+				if (e == 0) {
+					x *= layout::pow2(limits::digits);
+					e = layout::exponent(x) - limits::digits;
+				}
 
-			auto tan = sin_v / cos_v;
+				*exp = e - (layout::bias - 1);
+				return layout::with_exponent(x, layout::bias - 1);
+			} else {
+				const bool negative = x < T(0.0);
+				const auto [m, e] = detail::split_exponent(negative ? -x : x);
 
-			return spook::copysign(arg, tan);
+				*exp = e + 1;
+				return negative ? m * T(-0.5) : m * T(0.5);
+			}
 		}
-		
+
+		/**
+		* @brief x * 2^nを計算する
+		* @detail 結果が非正規化数になる時も丸めは1度だけ、オーバーフローは∞
+		*/
 		template<typename T>
-		SPOOK_CONSTEVAL auto asin(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (arg == 0.0) return arg;
-				if (T(1.0) < spook::fabs(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+		SPOOK_CONSTEVAL auto ldexp(T x, int n) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::ldexp(x, n);
 			}
 
-			//0 <= x の所で計算
-			const T x = spook::fabs(arg);
-			T x_sq = x * x;
-			T k = T(1.0);
-			T tmp = x;
-			T term = T(1.0);
-			T series = x;
-			T r{};  //積み残し
-			T t{};  //級数和の一時変数
+			if (x == T(0.0) || spook::isinf(x) || spook::isnan(x) || n == 0) return x;
 
-			do {
-				tmp *= k / (k + T(1.0)) * x_sq;
-				k += T(2.0);
-				term = tmp / k;
+			int e = 0;
+			const T m = spook::frexp(x, &e);
 
-				t = series + (term + r);
-				r = (term + r) - (t - series);
-				series = t;
-			} while (spook::fabs(term) >= spook::numeric_limits_traits<T>::epsilon());
+			//|x * 2^n| = |m| * 2^(e + n)、|m|は[0.5, 1)、e + nはintの範囲で比較する
+			if (limits::max_exponent - e < n) return (m < T(0.0)) ? -limits::infinity() : limits::infinity();
+			//非正規化数の最小値の半分にも満たないものは0
+			if (n < limits::min_exponent - limits::digits - e) return m * T(0.0);
+			if (limits::min_exponent <= e + n) return (m * T(2.0)) * detail::pow2<T>(e + n - 1);
 
-			return spook::copysign(series, arg);;
+			//一旦正規化数の範囲で誤差なく掛けてから、最後の乗算で1度だけ丸める
+			return (m * detail::pow2<T>(e + n + limits::digits)) * detail::pow2<T>(-limits::digits);
 		}
 
+		/**
+		* @brief x * 2^nを計算する、基数が2なのでldexpと同じ
+		*/
 		template<typename T>
-		SPOOK_CONSTEVAL auto acos(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (arg == 0.0) return arg;
-				if (T(1.0) < spook::fabs(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
-			}
-
-			return T(0.5) * constant::pi<T>* spook::asin(arg);
+		SPOOK_CONSTEVAL auto scalbn(T x, int n) -> T {
+			return spook::ldexp(x, n);
 		}
 
+		/**
+		* @brief xの指数部を取り出す（|x| = m * 2^ilogb(x)、mは[1, 2)）
+		* @return 0の時はFP_ILOGB0、NaNの時はFP_ILOGBNAN、∞の時はINT_MAX
+		*/
 		template<typename T>
-		SPOOK_CONSTEVAL auto atan(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (spook::iszero(arg)) return arg;
-				if (spook::isinf(arg)) return spook::copysign(spook::constant::pi<T> / 2.0, arg);
+		SPOOK_CONSTEVAL auto ilogb(T x) -> int {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::ilogb(x);
 			}
 
-			//0 < x の所で計算
-			const T x = spook::fabs(arg);
-			const T coeff = x / (T(1.0) + x * x);
-			const T coeff2 = x * coeff;
+			if (spook::isnan(x)) return FP_ILOGBNAN;
+			if (x == T(0.0)) return FP_ILOGB0;
+			if (spook::isinf(x)) return INT_MAX;
 
-			T k = T(1.0);
-			T tmp = T(1.0);
-			T series = T(1.0);
-			T r{};  //積み残し
-			T t{};  //級数和の一時変数
+			int e = 0;
+			(void)spook::frexp(x, &e);
 
-			do {
-				auto k_2 = k + k;
-				tmp *= k_2 / (k_2 + T(1.0)) * coeff2;
+			return e - 1;
+		}
 
-				t = series + (tmp + r);
-				r = (tmp + r) - (t - series);
-				series = t;
+		namespace detail {
 
-				k += T(1.0);
-			} while (spook::fabs(tmp) >= spook::numeric_limits_traits<T>::epsilon());
+			/**
+			* @brief aをbで割った余り（a, bは正の有限値）
+			* @detail 2進の筆算と同じく、aの指数に揃えたbの2^k倍を引いていく。各段の引き算はt <= a < 2tなので丸められない
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto fmod_positive(T a, T b) -> T {
+				const int eb = spook::ilogb(b);
 
-			//適正な符号へ戻す
-			return spook::copysign(coeff * series, arg);
-		}
+				while (b <= a) {
+					T t = spook::ldexp(b, spook::ilogb(a) - eb);
+					if (a < t) t *= T(0.5);
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto atan2(T y, T x) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (spook::iszero(y)) {
-					if (spook::signbit(x)) {
-						return spook::copysign(spook::constant::pi<T>, y);
-					}
-					else {
-						return spook::copysign(T(0.0), y);
-					}
+					a -= t;
 				}
 
-				if (spook::iszero(x)) {
-					return spook::copysign(spook::constant::pi<T> / T(2.0), y);
-				}
+				return a;
+			}
+		}
 
-				if (spook::isinf(y)) {
-					if (spook::isinf(x)) {
-						if (spook::signbit(x)) {
-							return spook::copysign(T(3.0) * spook::constant::pi<T> / T(4.0), y);
-						}
-						else {
-							return spook::copysign(spook::constant::pi<T> / T(4.0), y);
-						}
-					}
+		/**
+		* @brief x - n * y、nはx / yに最も近い整数（中間は偶数）
+		* @detail 結果は常に誤差なく表現できるので、定数式でも実行時と同じ値になる
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto remainder(T x, T y) -> T {
+			using limits = spook::numeric_limits_traits<T>;
 
-					return spook::copysign(spook::constant::pi<T> / T(2.0), y);
-				}
-				else {
-					if (spook::isinf(x)) {
-						if (spook::signbit(x)) {
-							return spook::copysign(spook::constant::pi<T>, y);
-						}
-						else {
-							return spook::copysign(T(0.0), y);
-						}
-					}
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::remainder(x, y);
+			}
+
+			if (detail::has_special_values<T>) {
+				if (spook::iszero(y) || spook::isinf(x) || spook::isnan(x) || spook::isnan(y)) {
+					return limits::quiet_NaN();
 				}
 			}
 
-			auto atan_v = spook::atan(y / x);
+			if (spook::iszero(x)) return x;
 
-			if (!spook::signbit(x)) {
-				return atan_v;
-			}
+			const T b = spook::fabs(y);
+
+			//|x|を2|y|で割った余りにしてから、商の偶奇を見て[-|y| / 2, |y| / 2]に寄せる
+			T r = (b <= (limits::max)() * T(0.5)) ? detail::fmod_positive(spook::fabs(x), b * T(2.0)) : spook::fabs(x);
 
-			if (spook::signbit(y)) {
-				return atan_v - spook::constant::pi<T>;
+			if (b < (limits::min)() * T(2.0)) {
+				//b / 2が丸められる範囲
+				if (b < r + r) {
+					r -= b;
+					if (b <= r + r) r -= b;
+				}
+			} else {
+				const T half = b * T(0.5);
+				if (half < r) {
+					r -= b;
+					if (half <= r) r -= b;
+				}
 			}
 
-			return atan_v + spook::constant::pi<T>;
+			return (x < T(0.0)) ? -r : r;
 		}
 
-		namespace detail {
-
-			/**
-			* @brief 入力が整数であるとわかっているときのためのexp
-			* @param arg e^argのarg、整数であること
-			* @return e^argを返す、近似計算ではない
-			*/
-			template<typename T>
-			SPOOK_CONSTEVAL auto simple_exp(T arg) -> T {
-				return spook::pow(constant::e<T>, size_t(arg));
+		/**
+		* @brief x - n * y、nはx / yを0方向に丸めた整数
+		* @detail 結果は常に誤差なく表現できるので、定数式でも実行時と同じ値になる
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto fmod(T x, T y) -> T {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::fmod(x, y);
 			}
-		}
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto exp(T arg) -> T {
-			if (spook::numeric_limits_traits<T>::is_iec559) {
-				if (arg == T(0.0)) return T(1.0);
-				if (spook::isinf(arg)) {
-					if (spook::signbit(arg)) return T(+0.0);
-					return arg;
+			if (detail::has_special_values<T>) {
+				bool y_is_zero = spook::iszero(y);
+
+				if (!y_is_zero && spook::iszero(x)) return x;
+				if (spook::isinf(x) || y_is_zero || spook::isnan(x) || spook::isnan(y)) {
+					return spook::numeric_limits_traits<T>::quiet_NaN();
+				}
+				else {
+					//xが有限であり、yが±∞であるとき
+					if (spook::isinf(y)) return x;
 				}
 			}
-			
-			//0 < x の範囲で計算
-			T x = spook::signbit(arg)? -arg : arg;
-
-			if (x == T(1.0)) return spook::signbit(arg) ? (1.0 / constant::e<T>) : constant::e<T>;
 
-			//1 < xのとき
-			if (1.0 < x) {
-				//小数点未満の部分とそれ以外の部分に分ける
-				T x1 = spook::floor(x);
-				T x2 = x - x1;
+			if (spook::iszero(x)) return x;
 
-				//それぞれのexpをかけて計算
-				T expx = spook::exp(x2) * detail::simple_exp(x1);
+			const T r = detail::fmod_positive(spook::fabs(x), spook::fabs(y));
 
-				return spook::signbit(arg) ? (1.0 / expx) : expx;
-			}
+			return (x < T(0.0)) ? -r : r;
+		}
 
-			T series = T(1.0);
-			T tmp = T(1.0);
-			T n = T(1.0);
-			T r{};  //積み残し
-			T t{};  //級数和の一時変数
+		/**
+		* @brief xの指数部を浮動小数点数で取り出す
+		* @return 0の時は-∞、∞の時は+∞
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto logb(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
 
-			//マクローリン級数の計算
-			do {
-				tmp *= x / n;
-				t = series + (tmp + r);
-				r = (tmp + r) - (t - series);
-				series = t;
-				n += T(1.0);
-			} while (spook::fabs(tmp) >= spook::numeric_limits_traits<T>::epsilon());
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x)) return x;
+				if (x == T(0.0)) return -limits::infinity();
+				if (spook::isinf(x)) return limits::infinity();
+			}
 
-			//適正な値へ
-			return spook::signbit(arg) ? (1.0 / series) : series;
+			return T(spook::ilogb(x));
 		}
 
-
+		/**
+		* @brief fromからtoの方向へ、次に表現可能な値
+		*/
 		template<typename T>
-		SPOOK_CONSTEVAL auto log(T x) -> T {
+		SPOOK_CONSTEVAL auto nextafter(T from, T to) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if constexpr (std::is_floating_point_v<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::nextafter(from, to);
+			}
+
+			if (spook::isnan(from) || spook::isnan(to)) return limits::quiet_NaN();
+			if (from == to) return to;
+			if (from == T(0.0)) return (to < T(0.0)) ? -limits::denorm_min() : limits::denorm_min();
+			if (spook::isinf(from)) return (from < T(0.0)) ? limits::lowest() : (limits::max)();
+
+			int e = 0;
+			const T m = spook::frexp(from, &e);
+			const bool away_from_zero = (from < to) == (T(0.0) < from);
+
+			//|from|の属する2冪の区間の間隔、非正規化数ではdenorm_min
+			const int step_exponent = (e < limits::min_exponent) ? limits::min_exponent - limits::digits : e - limits::digits;
+
+			if (away_from_zero) {
+				if (from == (limits::max)()) return limits::infinity();
+				if (from == limits::lowest()) return -limits::infinity();
+			} else if ((m == T(0.5) || m == T(-0.5)) && limits::min_exponent < e) {
+				//2の冪から0へ向かう時は、間隔が半分になる
+				const T step = spook::ldexp(T(1.0), step_exponent - 1);
+				return (T(0.0) < from) ? from - step : from + step;
+			}
 
-			T series = (x - 1) / (x + 1);
-			T tmp = series;
-			T k = T(3.0);
-			T term{};
-			T r{};  //積み残し
-			T t{};  //級数和の一時変数
-			const T sq = series * series;
+			const T step = spook::ldexp(T(1.0), step_exponent);
+			return ((T(0.0) < from) == away_from_zero) ? from + step : from - step;
+		}
 
-			//マクローリン級数の計算
-			do {
-				tmp *= sq;
-				term = tmp / k;
+		/**
+		* @brief xの1ulp、|x|とその次に大きい表現可能な値との差
+		* @return 0の時はdenorm_min、∞の時は∞
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto ulp(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
 
-				t = series + (term + r);
-				r = (term + r) - (t - series);
-				series = t;
+			if (spook::isnan(x)) return x;
+			if (spook::isinf(x)) return limits::infinity();
+			if (x == T(0.0)) return limits::denorm_min();
 
-				k += T(2.0);
-			} while (spook::fabs(term) >= spook::numeric_limits_traits<T>::epsilon());
+			int e = 0;
+			(void)spook::frexp(x, &e);
 
-			return series + series;
+			return spook::ldexp(T(1.0), (e < limits::min_exponent) ? limits::min_exponent - limits::digits : e - limits::digits);
 		}
 
 		namespace detail {
 
 			/**
-			* @brief 再帰的に2の累乗回の累乗を計算し、それらを適切に掛けることで掛け算回数を減らす
-			* @param x 2の累乗回かけてあるx
-			* @param prev_n 一つ前の冪の数（2の倍数
-			* @param pow_n 掛けるべき回数、関数が戻った後は残りの掛けるべき回数へ変化する
-			* @return 適切な回数かけられた途中結果
+			* @brief 2/piの2進展開（32bit毎、先頭の最上位ビットが小数第1位）
+			* @detail Payne-Hanekの引数還元で使用する、仮数部64bitまでの型についてlong doubleの最大指数まで賄える長さ
+			*/
+			inline constexpr std::uint32_t two_over_pi_bits[] = {
+				0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561,
+				0xB7246E3A, 0x424DD2E0, 0x06492EEA, 0x09D1921C, 0xFE1DEB1C, 0xB129A73E, 0xE88235F5, 0x2EBB4484,
+				0xE99C7026, 0xB45F7E41, 0x3991D639, 0x835339F4, 0x9C845F8B, 0xBDF9283B, 0x1FF897FF, 0xDE05980F,
+				0xEF2F118B, 0x5A0A6D1F, 0x6D367ECF, 0x27CB09B7, 0x4F463F66, 0x9E5FEA2D, 0x7527BAC7, 0xEBE5F17B,
+				0x3D0739F7, 0x8A5292EA, 0x6BFB5FB1, 0x1F8D5D08, 0x56033046, 0xFC7B6BAB, 0xF0CFBC20, 0x9AF4361D,
+				0xA9E39161, 0x5EE61B08, 0x6599855F, 0x14A06840, 0x8DFFD880, 0x4D732731, 0x06061556, 0xCA73A8C9,
+				0x60E27BC0, 0x8C6B47C4, 0x19C367CD, 0xDCE8092A, 0x8359C476, 0x8B961CA6, 0xDDAF44D1, 0x5719053E,
+				0xA5FF0705, 0x3F7E33E8, 0x32C2DE4F, 0x98327DBB, 0xC33D26EF, 0x6B1E5EF8, 0x9F3A1F35, 0xCAF27F1D,
+				0x87F12190, 0x7C7C246A, 0xFA6ED577, 0x2D30433B, 0x15C614B5, 0x9D19C3C2, 0xC4AD414D, 0x2C5D000C,
+				0x467D862D, 0x71E39AC6, 0x9B006233, 0x7CD2B497, 0xA7B4D555, 0x37F63ED7, 0x1810A3FC, 0x764D2A9D,
+				0x64ABD770, 0xF87C6357, 0xB07AE715, 0x175649C0, 0xD9D63B38, 0x84A7CB23, 0x24778AD6, 0x23545AB9,
+				0x1F001B0A, 0xF1DFCE19, 0xFF319F6A, 0x1E666157, 0x9947FBAC, 0xD87F7EB7, 0x652289E8, 0x3260BFE6,
+				0xCDC4EF09, 0x366CD43F, 0x5DD7DE16, 0xDE3B5892, 0x9BDE2822, 0xD2E88628, 0x4D58E232, 0xCAC616E3,
+				0x08CB7DE0, 0x50C017A7, 0x1DF35BE0, 0x1834132E, 0x62128301, 0x48835B8E, 0xF57FB0AD, 0xF2E91E43,
+				0x4A48D367, 0x10D8DDAA, 0x425FAECE, 0x616AA428, 0x0AB499D3, 0xF2A6067F, 0x775C83C2, 0xA3883C61,
+				0x78738A5A, 0x8CAFBDD7, 0x6F63A62D, 0xCBBFF4EF, 0x818D67C1, 0x2645CA55, 0x36D9CAD2, 0xA8288D61,
+				0xC277C912, 0x1426049B, 0x4612C459, 0xC444C5C8, 0x91B24DF3, 0x1700AD43, 0xD4E54929, 0x10D5FDFC,
+				0xBE00CC94, 0x1EEECE70, 0xF53E1380, 0xF1ECC3E7, 0xB328F8C7, 0x9405933E, 0x71C1B309, 0x2EF3450B,
+				0x9C12887B, 0x20AB9FB5, 0x2EC29247, 0x2F327B6D, 0x550C90A7, 0x721FE76B, 0x96CB314A, 0x1679E279,
+				0x4189DFF4, 0x9794E884, 0xE6E29731, 0x996BED88, 0x365F5F0E, 0xFDBBB49A, 0x486CA467, 0x42727132,
+				0x5D8DB815, 0x9F09E5BC, 0x25318D39, 0x74F71C05, 0x30010C0D, 0x68084B58, 0xEE2C90AA, 0x4702E774,
+				0x24D6BDA6, 0x7DF77248, 0x6EEF169F, 0xA6948EF6, 0x91B45153, 0xD1F20ACF, 0x3398207E, 0x4BF56863,
+				0xB25F3EDD, 0x035D407F, 0x89852952, 0x55C06437, 0x10D86D32, 0x4832754C, 0x5BD4714E, 0x6E5445C1,
+				0x090B69F5, 0x2AD56614, 0x9D072750, 0x045DDB3B, 0xB4C576EA, 0x17F9877D, 0x6B49BA27, 0x1D296996,
+				0xACCCC654, 0x14AD6AE2, 0x9089D988, 0x50722CBE, 0xA4049407, 0x777030F3, 0x27FC00A8, 0x71EA49C2,
+				0x663DE064, 0x83DD9797, 0x3FA3FD94, 0x438C860D, 0xDE41319D, 0x39928C70, 0xDDE7B717, 0x3BDF082B,
+				0x3715A080, 0x5C93805A, 0x921110D8, 0xE80FAF80, 0x6C4BFFDB, 0x0F903876, 0x185915A5, 0x62BBCB61,
+				0xB989C7BD, 0x401004F2, 0xD2277549, 0xF6B6EBBB, 0x22DBAA14, 0x0A2F2689, 0x76836433, 0x3B091A94,
+				0x0EAA3A51, 0xC2A31DAE, 0xEDAF1226, 0x5C4DC26D, 0x9C7A2D97, 0x56C0833F, 0x03F6F009, 0x8C402B99,
+				0x316D07B4, 0x3915200C, 0x5BC3D8C4, 0x92F54BAD, 0xC6A5CA4E, 0xCD37A736, 0xA9E69492, 0xAB6842DD,
+				0xDE6319EF, 0x8C76528B, 0x6837DBFC, 0xABA1AE31, 0x15DFA1AE, 0x00DAFB0C, 0x664D64B7, 0x05ED3065,
+				0x29BF5657, 0x3AFF47B9, 0xF96AF3BE, 0x75DF9328, 0x3080ABF6, 0x8C6615CB, 0x040622FA, 0x1DE4D9A4,
+				0xB33D8F1B, 0x5709CD36, 0xE9424EA4, 0xBE13B523, 0x331AAAF0, 0xA8654FA5, 0xC1D20F3F, 0x0BCD785B,
+				0x76F92304, 0x8B7B7217, 0x8953A6C6, 0xE26E6F00, 0xEBEF584A, 0x9BB7DAC4, 0xBA66AACF, 0xCF761D02,
+				0xD12DF1B1, 0xC1998C77, 0xADC3DA48, 0x86A05DF7, 0xF480C62F, 0xF0AC9AEC, 0xDDBC5C3F, 0x6DDED01F,
+				0xC790B6DB, 0x2A3A25A3, 0x9AAF0093, 0x53AD0457, 0xB6B42D29, 0x7E804BA7, 0x07DA0EAA, 0x76A1597B,
+				0x2A12162D, 0xB7DCFDE5, 0xFAFEDB89, 0xFDBE896C, 0x76E4FCA9, 0x0670803E, 0x156E85FF, 0x87FD073E,
+				0x28336761, 0x86182AEA, 0xBD4DAFE7, 0xB36E6D8F, 0x3967955B, 0xBF3148D7, 0x8416DF30, 0x432DC735,
+				0x6125CE70, 0xC9B8CB30, 0xFD6CBFA2, 0x00A4E46C, 0x05A0DD5A, 0x476F21D2, 0x1262845C, 0xB9496170,
+				0xE0566B01, 0x52993755, 0x50B7D51E, 0xC4F1335F, 0x6E13E430, 0x5DA92E85, 0xC3B21D36, 0x32A1A4B7,
+				0x08D4B1EA, 0x21F716E4, 0x698F77FF, 0x2780030C, 0x2D408DA0, 0xCD4F99A5, 0x20D3A2B3, 0x0A5D2F42,
+				0xF9B4CBDA, 0x11D0BE7D, 0xC1DB9BBD, 0x17AB81A2, 0xCA5C6A08, 0x17552E55, 0x0027F014, 0x7F8607E1,
+				0x640B148D, 0x4196DEBE, 0x872AFDDA, 0xB6256B34, 0x897BFEF3, 0x059EBFB9, 0x4F6A68A8, 0x2A4A5AC4,
+				0x4FBCF82D, 0x985AD795, 0xC7F48D4D, 0x0DA63A20, 0x5F57A4B1, 0x3F149538, 0x800120CC, 0x86DD71B6,
+				0xDEC9F560, 0xBF11654D, 0x6B0701AC, 0xB08CD0C0, 0xB2485551, 0x0EFB1EC3, 0x72953B06, 0xA33540C0,
+				0x7BDC06CC, 0x45E0FA29, 0x4EC8CAD6, 0x41F3E8DE, 0x647CD864, 0x9B31BED9, 0xC397A4D4, 0x5877C5E3,
+				0x6913DAF0, 0x3C3ABA46, 0x18465F75, 0x55F5BDD2, 0xC6926E5D, 0x2EACED44, 0x0E423E1C, 0x87C461E9,
+				0xFD29F3D6, 0xE7CA7C22, 0x35916FC5, 0xE0088DD7, 0xFFE26A6E, 0xC6FDB0C1, 0x0893745D, 0x7CB2AD6B,
+				0x9D6ECD7B, 0x723E6A11, 0xC6A9CFF7, 0xDF7329BA, 0xC9B55100, 0xB70DB2E2, 0x24BA7460, 0x7DE58AD8,
+				0x742C150D, 0x0C188194, 0x667E1629, 0x01767A9F, 0xBEFDFDEF, 0x4556367E, 0xD913D9EC, 0xB9BA8BFC,
+				0x97C427A8, 0x31C36EF1, 0x36C59456, 0xA8D8B5A8, 0xB40ECCCF, 0x2D891234, 0x576F8956, 0x2CE3CE99,
+				0xB920D6AA, 0x5E6B9C2A, 0x3ECC5F11, 0x4A0BFDFB, 0xF4E16D3B, 0x8E2C86E2, 0x84D4E9A9, 0xB4FCD1EE,
+				0xEFC9352E, 0x61392F44, 0x2138C8D9, 0x1B0AFC81, 0x6A4AFBD8, 0x1C2F84B4, 0x538C994E, 0xCC2254DC,
+				0x552AD6C6, 0xC096190B, 0xB8701A64, 0x9569605A, 0x26EE523F, 0x0F117F11, 0xB5F4F5CB, 0xFC2DBC34,
+				0xEEBC34CC, 0x5DE8605E, 0xDD9B8E67, 0xEF3392B8, 0x17C99B58, 0x61BC57E1, 0xC6835110, 0x3ED84871,
+				0xDDDD1C2D, 0xA118AF46, 0x2C21D7F3, 0x59987AD9, 0xC0549EFA, 0x864FFC06, 0x56AE79E5, 0x36228922,
+				0xAD38DC93, 0x67AAE855, 0x3826829B, 0xE7CAA40D, 0x51B13399, 0x0ED7A948, 0x0569F0B2, 0x65A7887F,
+				0x974C8836, 0xD1F9B392, 0x214A827B, 0x21CF98DC, 0x9F405547, 0xDC3A74E1, 0x42EB67DF, 0x9DFE5FD4,
+				0x5EA4677B, 0x7AACBAA2, 0xF6552388, 0x2B55BA41, 0x086E5986, 0x2A218347, 0x39E6E389, 0xD49EE540,
+				0xFB49E956, 0xFFCA0F1C, 0x8A59C52B, 0xFA94C5C1, 0xD3CFC50F, 0xAE5ADB86, 0xC5476243, 0x853B8621,
+				0x94792C87, 0x61107B4C, 0x2A1A2C80, 0x12BF4390, 0x2688893C, 0x78E4C4A8, 0x7BDBE5C2, 0x3AC4EAF4,
+				0x268A67F7, 0xBF920D2B, 0xA365B193, 0x3D0B7CBD, 0xDC51A463, 0xDD27DDE1, 0x6919949A, 0x9529A828,
+				0xCE68B4ED, 0x09209F44, 0xCA984E63, 0x8270237C, 0x7E32B90F, 0x8EF5A7E7, 0x561408F1, 0x212A9DB5,
+				0x4D7E6F51, 0x19A5ABF9, 0xB5D6DF82, 0x61DD9602, 0x36169F3A, 0xC4A1A283, 0x6DED727A, 0x8D39A9B8,
+				0x825C326B, 0x5B2746ED, 0x34007700, 0xD255F4FC, 0x4D590180, 0x71E0E13F, 0x89B295F3, 0x64A8F1AE,
+			};
+
+			/**
+			* @brief pi/2の2進展開（32bit毎、先頭の最上位ビットが整数部）
+			* @detail Cody-Waiteの引数還元で使用する分割定数の元
+			*/
+			inline constexpr std::uint32_t pi_over_2_bits[] = {
+				0xC90FDAA2, 0x2168C234, 0xC4C6628B, 0x80DC1CD1, 0x29024E08, 0x8A67CC74, 0x020BBEA6, 0x3B139B22,
+				0x514A0879, 0x8E3404DD, 0xEF9519B3, 0xCD3A431B,
+			};
+
+			/**
+			* @brief 正の正規化数xを、x = m * 2^eとなる整数の仮数mと指数eに分解する
+			* @param x 正の正規化数、仮数部は64bit以下であること
+			* @return {仮数m（digitsビット）, 指数e}
 			*/
 			template<typename T>
-			SPOOK_CONSTEVAL auto pow_impl(T x, std::size_t prev_n, std::size_t& pow_n) -> T {
-				//現在のかけた回数
-				std::size_t now_n = prev_n + prev_n;
+			SPOOK_CONSTEVAL auto decompose(T x) -> std::pair<std::uint64_t, int> {
+				using limits = spook::numeric_limits_traits<T>;
+				static_assert(limits::digits <= 64, "spook::detail::decompose() supports up to 64bit mantissa.");
 
-				if (now_n <= pow_n) {
-					//x^2を計算し、次へ
-					auto powx = pow_impl(x*x, now_n, pow_n);
-					//終わったら、残りのかける回数を調べて必要ならかけて返す
-					if (prev_n <= pow_n) {
-						pow_n -= prev_n;
-						powx *= x;
-					}
-					return powx;
-				}
-				else {
-					//掛けるべき回数を超えた時は一つ前の結果を最大として戻る
-					pow_n -= prev_n;
-					return x;
-				}
+				int e = 0;
+				const T m = spook::frexp(x, &e);
+
+				return { static_cast<std::uint64_t>(spook::ldexp(m, limits::digits)), e - limits::digits };
 			}
-		}
 
-		template<typename T, typename N>
-		SPOOK_CONSTEVAL auto pow(T x, N y) -> T {
-			if constexpr (spook::is_integral_v<N>) {
-				//0 < nの所で計算
-				std::size_t n = spook::abs(y);
+			/**
+			* @brief 誤差なしの加算（a + b = s + e）
+			* @return {s, e}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto two_sum(T a, T b) -> std::pair<T, T> {
+				const T s = a + b;
+				const T v = s - a;
+				return { s, (a - (s - v)) + (b - v) };
+			}
 
-				if (n == 0)
-					return T(1.0);
-				if (n == 1)
-					return spook::signbit(y) ? T(1.0) / x : x;
+			/**
+			* @brief |a| >= |b|の時の誤差なしの加算（a + b = s + e）
+			* @return {s, e}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto fast_two_sum(T a, T b) -> std::pair<T, T> {
+				const T s = a + b;
+				return { s, b - (s - a) };
+			}
 
-				auto x_pow_y = detail::pow_impl(x * x, 2, n);
+			/**
+			* @brief Dekkerの方法による誤差なしの乗算（a * b = p + e）
+			* @detail 実行時に高速なfma命令があれば、それで誤差を求める（結果は同じ）
+			* @return {p, e}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto two_prod(T a, T b) -> std::pair<T, T> {
+				if constexpr (detail::has_fast_fma<T>) {
+					if (!SPOOK_IS_CONSTANT_EVALUATED()) {
+						const T p = a * b;
+						return { p, std::fma(a, b, -p) };
+					}
+				}
 
-				//奇数乗の時
-				if (n == 1)
-					x_pow_y *= x;
+				constexpr int half = (spook::numeric_limits_traits<T>::digits + 1) / 2;
+				constexpr T splitter = detail::scale2(T(1.0), half) + T(1.0);
 
-				//負の冪なら逆数へ
-				return spook::signbit(y) ? T(1.0) / x_pow_y : x_pow_y;
-			} else if constexpr (spook::is_floating_point_v<N>) {
-				//TとNが一致しないならば、常にlong doubleを使用して計算
-				using floating_t = std::conditional_t<std::is_same_v<T, N>, T, long double>;
+				//上位と下位に半分ずつ分割する
+				const T ca = splitter * a;
+				const T ah = ca - (ca - a);
+				const T al = a - ah;
+				const T cb = splitter * b;
+				const T bh = cb - (cb - b);
+				const T bl = b - bh;
+				const T p = a * b;
 
-				floating_t logx = spook::log(floating_t(x));
-				return T(spook::exp(y * logx));
-			} else {
-				//その他の型に対しては未定義
-				static_assert([]{return false;}(), "spook::pow<T, N>() is not implemented.");
+				return { p, ((ah * bh - p) + ah * bl + al * bh) + al * bl };
 			}
-		}
-
-		template<size_t N, typename T>
-		SPOOK_CONSTEVAL auto n_root(T x) -> T {
-			if (spook::signbit(x)) return spook::numeric_limits_traits<T>::quiet_NaN();
 
-			const T c1 = T(N + 1) / T(N);
-			const T c2 = -x / T(N);
-
-			//初期値依存が激しいので考察の余地あり
-			T xk = T(1.0) / x;
-			T x_prev{};
+			/**
+			* @brief 2進展開の表から、[first, first + count)ビット目を取り出して値にする
+			* @param bits 2進展開の表
+			* @param first 取り出す先頭のビット位置
+			* @param count 取り出すビット数、Tの仮数部の桁数以下であること
+			* @param weight 表の先頭ビットの重み（2^weight）
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto from_bits(const std::uint32_t(&bits)[N], int first, int count, int weight) -> T {
+				T value{};
 
-			do {
-				x_prev = xk;
-				xk *= (c1 + c2 * spook::pow(xk, N));
-				if (spook::isinf(xk)) break;
-			} while (spook::fabs(xk - x_prev) >= spook::numeric_limits_traits<T>::epsilon());
+				while (0 < count) {
+					const int offset = first % 32;
+					const int n = (32 - offset < count) ? 32 - offset : count;
+					const std::uint64_t chunk = (std::uint64_t(bits[first / 32]) >> (32 - offset - n)) & ((std::uint64_t(1) << n) - 1);
 
-			return spook::fabs(x * spook::pow(xk, N - 1));
-		}
+					//上位から足していくので誤差は出ない
+					value += detail::scale2(T(chunk), weight - (first + n - 1));
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto sqrt(T x) -> T {
-			return n_root<2>(x);
-		}
+					first += n;
+					count -= n;
+				}
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto cbrt(T x) -> T {
-			return n_root<3>(x);
-		}
+				return value;
+			}
 
-		template<typename T>
-		SPOOK_CONSTEVAL auto lerp(T a, T b, T t) -> T {
-			if (spook::iszero(t)) return a;
-			if (t == T(1.0)) return b;
-			if (spook::isfinite(t) && a == b) return a;
+			/**
+			* @brief dd<T>の上位の型T、それ以外は型そのもの
+			*/
+			template<typename T>
+			struct upper_type {
+				using type = T;
+			};
 
-			return a + t * (b - a);
-		}
-	}
+			template<typename T>
+			struct upper_type<double_double::dd<T>> {
+				using type = T;
+			};
 
-	inline namespace complex {
+			/**
+			* @brief pi/2の倍数を引いた三角関数の引数
+			* @detail 引数x = quadrant * pi/2 + (hi + lo) (mod 2pi)
+			*/
+			template<typename T>
+			struct reduced_angle {
+				T hi;          //[-pi/4, pi/4]に還元された値の上位
+				T lo;          //[-pi/4, pi/4]に還元された値の下位
+				int quadrant;  //pi/2の何倍か（mod 4）
+			};
 
-		template<typename T CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
-		SPOOK_CONSTEVAL auto polar(T rho, T theta) -> std::complex<T> {
-			return{ rho * spook::cos(theta), rho * spook::sin(theta) };
-		}
-	}
+			/**
+			* @brief Payne-Hanekの方法が使用可能な型か
+			*/
+			template<typename T>
+			inline constexpr bool is_payne_hanek_reducible_v = spook::numeric_limits_traits<T>::radix == 2
+				&& spook::numeric_limits_traits<T>::digits <= 64
+				&& spook::numeric_limits_traits<T>::max_exponent <= 16384;
 
-	inline namespace bit {
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto countr_zero(T x) -> int;
-	}
+			/**
+			* @brief Cody-Waiteの方法で使用するpi/2の4分割
+			* @detail 前3つはdigits - bound_bitsビットで、bound_bitsビット以下の整数との積が丸められない
+			*/
+			template<typename T>
+			struct cody_waite_pi_over_2 {
+				static constexpr int digits = spook::numeric_limits_traits<T>::digits;
+				//この型で扱う商の上限（2^bound_bits）
+				static constexpr int bound_bits = digits / 3;
+				static constexpr int part_bits = digits - bound_bits;
+
+				static constexpr T p1 = detail::from_bits<T>(pi_over_2_bits, 0, part_bits, 0);
+				static constexpr T p2 = detail::from_bits<T>(pi_over_2_bits, part_bits, part_bits, 0);
+				static constexpr T p3 = detail::from_bits<T>(pi_over_2_bits, 2 * part_bits, part_bits, 0);
+				static constexpr T p4 = detail::from_bits<T>(pi_over_2_bits, 3 * part_bits, digits, 0);
+
+				static constexpr T two_over_pi = detail::from_bits<T>(two_over_pi_bits, 0, digits, -1);
+				static constexpr T bound = detail::scale2(T(1.0), bound_bits);
+			};
 
-	inline namespace numeric {
+			/**
+			* @brief x - fn * pi/2を上位と下位の2つの値で計算する
+			* @param fn x * 2/piに最も近い整数、2^bound_bits未満であること
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto cody_waite_remainder(T x, T fn) -> std::pair<T, T> {
+				using cw = cody_waite_pi_over_2<T>;
 
-		namespace detail {
+				//x - n * p1とn * p2, n * p3は丸められない
+				const auto [s1, e1] = detail::two_sum(x - fn * cw::p1, -(fn * cw::p2));
+				const auto [s2, e2] = detail::two_sum(s1, -(fn * cw::p3));
 
-			struct mod_def {
+				return detail::fast_two_sum(s2, (e1 + e2) - fn * cw::p4);
+			}
 
-				template<typename T>
-				SPOOK_CONSTEVAL auto operator()(T m, T n) -> T {
-					if constexpr (spook::is_floating_point_v<T>) {
-						return spook::fmod(m, n);
-					} else {
-						return m % n;
-					}
-				}
-			};
-			
 			/**
-			* @brief ユークリッドの互除法によるジェネリックな実装
-			* @detail 型Rはdoubleからの変換が可能であり、コピー（ムーブ）構築・代入が可能である必要がある
-			* @param m, n 最大公約数を求める値のペア、前処理済
-			* @param mod 剰余を求める関数オブジェクト
-			* @return GCD
+			* @brief Cody-Waiteの方法による引数還元
+			* @param x 正の値、x * 2/pi < 2^bound_bitsであること
 			*/
-			template <typename R, typename Mod>
-			SPOOK_CONSTEVAL auto gcd_impl(R m, R n, Mod mod) -> R {
-				const R zero = R(0.0);
+			template<typename T>
+			SPOOK_CONSTEVAL auto reduce_cody_waite(T x) -> reduced_angle<T> {
+				using cw = cody_waite_pi_over_2<T>;
 
-				do {
-					R oldn = n;
-					n = mod(m ,n);
-					m = oldn;
-				} while (n != zero);
+				const auto n = static_cast<std::int64_t>(x * cw::two_over_pi + T(0.5));
+				const auto [hi, lo] = detail::cody_waite_remainder(x, T(n));
 
-				return R(m);
+				return { hi, lo, static_cast<int>(n & 3) };
 			}
 
 			/**
-			* @brief 符号なし整数型用の効率的な実装
-			* @param m, n 最大公約数を求める値のペア、前処理済
-			* @return GCD
+			* @brief Payne-Hanekの方法による引数還元
+			* @detail x * 2/piの、整数部の下位2bitと小数部だけを多倍長整数の積で求める
+			* @param x 正の有限値
 			*/
-			template <typename I>
-			SPOOK_CONSTEVAL auto gcd_impl(I m, I n) -> I {
-				//素の値を取り出す（2^n倍を出来るだけ戻す）
-				const auto m_zeros = spook::countr_zero(m);
-				m >>= m_zeros;
-				const auto common_zeros = std::min(m_zeros, spook::countr_zero(n));
-				n >>= common_zeros;
+			template<typename T>
+			SPOOK_CONSTEVAL auto reduce_payne_hanek(T x) -> reduced_angle<T> {
+				constexpr int digits = spook::numeric_limits_traits<T>::digits;
+				//2/piのうち使用するワード数
+				constexpr int window = 8;
+				constexpr int size = window + 2;
 
-				do {
-					//nの素の値を取り出す（2^nで割る）
-					n >>= spook::countr_zero(n);
+				const auto [m, e] = detail::decompose(x);
 
-					//常にnが大きくなるようにswap
-					if (n < m) {
-						auto temp = m;
-						m = n;
-						n = temp;
-					}
+				//これより上位のワードとの積は4の倍数となり結果に影響しない
+				const int first = (e < 2) ? 0 : (e - 2) / 32;
 
-					//大きい方から小さい方を引く、ゼロになるまで
-					n -= m;
-				} while (n != 0);
+				//p = m * (2/piのwindowワード分)、32bit毎のリトルエンディアン
+				std::uint32_t p[size]{};
+				const std::uint64_t mw[2] = { m & 0xFFFFFFFFu, m >> 32 };
 
-				//最終的にゼロになった時に引いた数字が最大公約数（最初に素の値にした分を元に戻す）
-				return m << common_zeros;
-			}
-		}
+				for (int i = 0; i < window; ++i) {
+					const std::uint64_t w = two_over_pi_bits[first + window - 1 - i];
+					std::uint64_t carry = 0;
 
-		template<typename M, typename N, typename Mod= detail::mod_def>
-		SPOOK_CONSTEVAL auto gcd(M mx, N nx, [[maybe_unused]] Mod&& mod = detail::mod_def{}) -> std::common_type_t<M, N> {
-			using R = std::common_type_t<M, N>;
+					for (int j = 0; j < 2; ++j) {
+						const std::uint64_t t = w * mw[j] + p[i + j] + carry;
+						p[i + j] = static_cast<std::uint32_t>(t);
+						carry = t >> 32;
+					}
+					p[i + 2] = static_cast<std::uint32_t>(carry);
+				}
 
-			if (spook::iszero(mx)) return R(nx);
-			if (spook::iszero(nx)) return R(mx);
+				//x * 2/pi = p * 2^-point
+				const int point = 32 * (first + window) - e;
+
+				//posビット目から上位64bitを取り出す、範囲外は0
+				const auto read64 = [&p](int pos) -> std::uint64_t {
+					const int limb = (pos < 0) ? -((31 - pos) / 32) : pos / 32;
+					const int offset = pos - 32 * limb;
+					const auto at = [&p](int i) -> std::uint64_t { return (0 <= i && i < size) ? p[i] : 0u; };
+
+					std::uint64_t r = (at(limb) >> offset) | (at(limb + 1) << (32 - offset));
+					if (offset != 0) r |= at(limb + 2) << (64 - offset);
+					return r;
+				};
+
+				int quadrant = static_cast<int>((read64(point) & 3u));
+				bool negative = false;
+
+				//小数部が1/2以上なら、次の整数からの負の距離とする
+				if ((p[(point - 1) / 32] >> ((point - 1) % 32)) & 1u) {
+					++quadrant;
+					negative = true;
+
+					//小数部の2の補数を取る
+					std::uint64_t carry = 1;
+					for (int i = 0; i < size; ++i) {
+						const std::uint64_t t = std::uint64_t(~p[i] & 0xFFFFFFFFu) + carry;
+						p[i] = static_cast<std::uint32_t>(t);
+						carry = t >> 32;
+					}
+				}
 
-			if constexpr (spook::is_integral_v<M> && spook::is_integral_v<N>) {
-				using UR = std::make_unsigned_t<R>;
+				//小数部以外を落とす
+				for (int i = 0; i < size; ++i) {
+					if (point <= 32 * i) {
+						p[i] = 0;
+					} else if (point < 32 * (i + 1)) {
+						p[i] &= (std::uint32_t(1) << (point - 32 * i)) - 1u;
+					}
+				}
 
-				//整数型用の処理
-				UR abs_m = UR(spook::abs(mx));
-				UR abs_n = UR(spook::abs(nx));
+				//小数部の最上位ビット
+				int top = point - 1;
+				while (0 <= top && ((p[top / 32] >> (top % 32)) & 1u) == 0) --top;
+				if (top < 0) return { T(0.0), T(0.0), quadrant & 3 };
 
-				return R(detail::gcd_impl(abs_m, abs_n));
-			} else {
-				const R abs_m = R(spook::abs(mx));
-				const R abs_n = R(spook::abs(nx));
+				//小数部 = (a + b * 2^-64) * 2^(top - 63 - point)
+				const std::uint64_t a = read64(top - 63);
+				const std::uint64_t b = read64(top - 127);
+				const std::uint64_t a_hi = (digits < 64) ? a & ~((std::uint64_t(1) << ((64 - digits) & 63)) - 1u) : a;
 
-				R m = std::max(abs_m, abs_n);
-				R n = std::min(abs_m, abs_n);
+				const int exponent = top - 63 - point;
+				const T f_hi = detail::scale2(T(a_hi), exponent);
+				const T f_lo = detail::scale2(T(a - a_hi) + detail::scale2(T(b), -64), exponent);
 
-				return detail::gcd_impl(m, n, std::forward<Mod>(mod));
+				//pi/2を掛ける
+				const T q1 = detail::from_bits<T>(pi_over_2_bits, 0, digits, 0);
+				const T q2 = detail::from_bits<T>(pi_over_2_bits, digits, digits, 0);
+
+				const auto [r_hi, r_err] = detail::two_prod(f_hi, q1);
+				const auto [hi, lo] = detail::fast_two_sum(r_hi, r_err + (f_hi * q2 + f_lo * q1));
+
+				return negative ? reduced_angle<T>{ -hi, -lo, quadrant & 3 } : reduced_angle<T>{ hi, lo, quadrant & 3 };
 			}
-		}
 
-		template <typename M, typename N, typename Mod= detail::mod_def>
-		SPOOK_CONSTEVAL auto lcm(M mx, N nx, [[maybe_unused]] Mod&& mod = detail::mod_def{}) -> std::common_type_t<M, N> {
-			using R = std::common_type_t<M, N>;
+			/**
+			* @brief dd<T>のPayne-Hanekの方法による引数還元
+			* @detail 上位と下位それぞれのx * 2/piを小数点以下words語の固定小数点で求めて足し合わせ、
+			*         小数部の上位2 * digitsビットにdd<T>の精度のpi/2を掛ける
+			* @param x 正の有限値
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto reduce_payne_hanek_dd(const double_double::dd<T>& x) -> reduced_angle<double_double::dd<T>> {
+				using dd = double_double::dd<T>;
+				constexpr int digits = spook::numeric_limits_traits<T>::digits;
+				//pi/2の倍数に近く上位が打ち消し合っても、2 * digitsビット以上が残る語数
+				constexpr int words = (4 * digits + 64 + 31) / 32;
+				constexpr int size = words + 1;
+				constexpr int table_size = int(std::extent_v<decltype(two_over_pi_bits)>);
+
+				//x * 2/pi mod 4、32bit毎のリトルエンディアンで最上位の語が整数部
+				std::uint32_t acc[size]{};
+
+				//to[i]にvを足して繰り上がりを上位へ伝える、i < 0の語は切り捨てる
+				const auto add = [](std::uint32_t(&to)[size], int i, std::uint64_t v) {
+					for (; i < size && v != 0; ++i) {
+						if (i < 0) {
+							v >>= 32;
+						} else {
+							const std::uint64_t t = std::uint64_t(to[i]) + (v & 0xFFFFFFFFu);
+							to[i] = static_cast<std::uint32_t>(t);
+							v = (v >> 32) + (t >> 32);
+						}
+					}
+				};
 
-			if (spook::iszero(mx) || spook::iszero(nx)) return R(0.0);
+				//to[0]の最下位をビット0として、posビット目からvを足す
+				const auto add_bits = [&add](std::uint32_t(&to)[size], int pos, std::uint64_t v) {
+					const int limb = (pos < 0) ? -((31 - pos) / 32) : pos / 32;
+					const int offset = pos - 32 * limb;
 
-			if constexpr (spook::is_integral_v<M> && spook::is_integral_v<N>){
-				using UR = std::make_unsigned_t<R>;
-				//整数型用の処理
-				UR abs_m = UR(spook::abs(mx));
+					add(to, limb, v << offset);
+					if (offset != 0) add(to, limb + 2, v >> (64 - offset));
+				};
+
+				for (const T c : { x.hi, x.lo }) {
+					if (spook::iszero(c)) continue;
+
+					const auto [m, e] = detail::decompose(spook::fabs(c));
+					const std::uint64_t mw[2] = { m & 0xFFFFFFFFu, m >> 32 };
+					std::uint32_t part[size]{};
+
+					//これより上位の語との積は4の倍数となり結果に影響しない
+					for (int i = (e < 2) ? 0 : (e - 2) / 32; i < table_size; ++i) {
+						//m * two_over_pi_bits[i]の最下位ビットの位置
+						const int pos = e - 32 * (i + 1) + 32 * words;
+						if (pos + 96 <= 0) break;
+
+						add_bits(part, pos, two_over_pi_bits[i] * mw[0]);
+						add_bits(part, pos + 32, two_over_pi_bits[i] * mw[1]);
+					}
+
+					//負の値は2の補数で引く
+					if (c < T(0.0)) {
+						std::uint64_t carry = 1;
+						for (int i = 0; i < size; ++i) {
+							const std::uint64_t t = std::uint64_t(~part[i] & 0xFFFFFFFFu) + carry;
+							part[i] = static_cast<std::uint32_t>(t);
+							carry = t >> 32;
+						}
+					}
+					for (int i = 0; i < size; ++i) add(acc, i, part[i]);
+				}
+
+				int quadrant = static_cast<int>(acc[words] & 3u);
+				bool negative = false;
+
+				//小数部が1/2以上なら、次の整数からの負の距離とする
+				if (acc[words - 1] >> 31) {
+					++quadrant;
+					negative = true;
+
+					std::uint64_t carry = 1;
+					for (int i = 0; i < words; ++i) {
+						const std::uint64_t t = std::uint64_t(~acc[i] & 0xFFFFFFFFu) + carry;
+						acc[i] = static_cast<std::uint32_t>(t);
+						carry = t >> 32;
+					}
+				}
+
+				//小数部の最上位ビット
+				int top = 32 * words - 1;
+				while (0 <= top && ((acc[top / 32] >> (top % 32)) & 1u) == 0) --top;
+				if (top < 0) return { dd(T(0.0)), dd(T(0.0)), quadrant & 3 };
+
+				//posビット目から上位digitsビットを取り出す、範囲外は0
+				const auto read = [&acc](int pos) -> std::uint64_t {
+					std::uint64_t r = 0;
+					for (int i = pos + digits - 1; pos <= i; --i) {
+						r = (r << 1) | ((0 <= i && ((acc[i / 32] >> (i % 32)) & 1u)) ? 1u : 0u);
+					}
+					return r;
+				};
+
+				//小数部 = (a + b * 2^-digits) * 2^(top + 1 - digits - 32 * words)
+				const int exponent = top + 1 - digits - 32 * words;
+				const T a = detail::scale2(T(read(top + 1 - digits)), exponent);
+				const T b = detail::scale2(T(read(top + 1 - 2 * digits)), exponent - digits);
+
+				//pi/2を掛ける
+				const T q1 = detail::from_bits<T>(pi_over_2_bits, 0, digits, 0);
+				const T q2 = detail::from_bits<T>(pi_over_2_bits, digits, digits, 0);
+				const T q3 = detail::from_bits<T>(pi_over_2_bits, 2 * digits, digits, 0);
+
+				const dd r = dd(a, b) * dd::from_parts(q1, q2) + dd(a * q3);
+
+				return { negative ? -r : r, dd(T(0.0)), quadrant & 3 };
+			}
+
+			/**
+			* @brief 三角関数の入力を[-pi/4, pi/4]の範囲に還元する
+			* @detail 小さな値はCody-Waite、大きな値はPayne-Hanekの方法による。dd<T>は常にPayne-Hanekの方法による
+			* @param theta θ[rad]、有限値であること
+			* @return {還元したθの上位, 下位, pi/2の何倍か（mod 4）}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto reduce_pi_over_2(T theta) -> reduced_angle<T> {
+				const bool negative = spook::signbit(theta);
+				const T x = negative ? -theta : theta;
+
+				reduced_angle<T> r{ x, T(0.0), 0 };
+
+				if (x <= constant::pi<T> / T(4.0)) {
+					//還元する必要はない
+					return { theta, T(0.0), 0 };
+				} else if constexpr (!std::is_same_v<typename upper_type<T>::type, T>) {
+					r = detail::reduce_payne_hanek_dd(x);
+				} else if constexpr (is_payne_hanek_reducible_v<T>) {
+					using cw = cody_waite_pi_over_2<T>;
+
+					if (x * cw::two_over_pi < cw::bound) {
+						r = detail::reduce_cody_waite(x);
+					} else {
+						r = detail::reduce_payne_hanek(x);
+					}
+				} else {
+					//任意精度の型等、2進のビット列を扱えない型ではpi/2で割った余りを直接求める
+					const T pi_2 = constant::pi<T> / T(2.0);
+					const T n = spook::floor(x / pi_2 + T(0.5));
+					const T rem = x - n * pi_2;
+
+					r = { rem, T(0.0), static_cast<int>(spook::fmod(n, T(4.0))) };
+				}
+
+				if (negative) return { -r.hi, -r.lo, (4 - r.quadrant) & 3 };
+				return r;
+			}
+
+			/**
+			* @brief 級数z^(k + 1) * c_kの項数、定義域の端で打ち切った項が2^-(digits + 2)を下回るまで
+			* @param z 変数の大きさの上限
+			* @param magnitude |c_k|を返す関数
+			*/
+			template<typename F>
+			constexpr auto series_terms(double z, int digits, F magnitude) -> std::size_t {
+				double tail = 1.0;
+				for (int i = 0; i < digits + 2; ++i) tail *= 0.5;
+
+				double power = z;
+				std::size_t k = 0;
+				while (tail <= power * magnitude(k)) {
+					power *= z;
+					++k;
+				}
+				return k;
+			}
+
+			/**
+			* @brief 1 / n!
+			*/
+			constexpr auto inverse_factorial(std::size_t n) -> double {
+				double r = 1.0;
+				for (std::size_t i = 2; i <= n; ++i) r /= double(i);
+				return r;
+			}
+
+			/**
+			* @brief 最良近似多項式の無い精度（dd<T>等）で使う、固定次数のマクローリン級数の係数
+			* @detail 項数はDigitsと各カーネルの定義域から決まる。収束を判定するループを持たないので、定数式での評価の回数が引数によらず一定になる
+			*/
+			template<typename T, int Digits>
+			struct kernel_series {
+				using upper = typename upper_type<T>::type;
+
+				/**
+				* @brief 項数と、上位の型で計算してよい項の先頭
+				* @detail dd<T>では、大きさが2^-(Tの桁数 + 2)を下回る項は上位のTだけで足りる
+				*/
+				template<typename F>
+				static constexpr auto terms(double z, F magnitude) -> std::pair<std::size_t, std::size_t> {
+					const std::size_t n = detail::series_terms(z, Digits, magnitude);
+
+					if constexpr (std::is_same_v<upper, T>) {
+						return { n, n };
+					} else {
+						return { n, detail::series_terms(z, Digits - spook::numeric_limits_traits<upper>::digits, magnitude) };
+					}
+				}
+
+				//sin(x) = x + x^3 * (sin[0] + sin[1] * x^2 + ...)、x^2 <= (pi/4)^2
+				static constexpr auto sin_terms = kernel_series::terms(0.6169, [](std::size_t k) { return detail::inverse_factorial(2 * k + 3); });
+				//cos(x) = 1 - x^2 / 2 + x^4 * (cos[0] + cos[1] * x^2 + ...)
+				static constexpr auto cos_terms = kernel_series::terms(0.6169, [](std::size_t k) { return detail::inverse_factorial(2 * k + 4); });
+				//exp(r) - 1 = r + r^2 * (expm1[0] + expm1[1] * r + ...)、|r| <= log(2)/2
+				static constexpr auto expm1_terms = kernel_series::terms(0.3466, [](std::size_t k) { return detail::inverse_factorial(k + 2); });
+				//log(1 + f)の2 * atanh(s) / s - 2 = z * (log[0] + log[1] * z + ...)、z = s^2 <= (3 - 2sqrt(2))^2
+				static constexpr auto log_terms = kernel_series::terms(0.02944, [](std::size_t k) { return 2.0 / double(2 * k + 3); });
+				//atan(x) = x + x * z * (atan[0] + atan[1] * z + ...)、z = x^2 <= tan(pi/8)^2
+				static constexpr auto atan_terms = kernel_series::terms(0.1716, [](std::size_t k) { return 1.0 / double(2 * k + 3); });
+
+				T sin[sin_terms.first]{};
+				T cos[cos_terms.first]{};
+				T expm1[expm1_terms.first]{};
+				T log[log_terms.first]{};
+				T atan[atan_terms.first]{};
+
+				constexpr kernel_series() {
+					//(-1)^(k + 1) / (2k + 3)!
+					T f = T(1.0) / T(6.0);
+					for (std::size_t k = 0; k < sin_terms.first; ++k) {
+						sin[k] = (k % 2 == 0) ? -f : f;
+						f /= T(double((2 * k + 4) * (2 * k + 5)));
+					}
+
+					//(-1)^k / (2k + 4)!
+					f = T(1.0) / T(24.0);
+					for (std::size_t k = 0; k < cos_terms.first; ++k) {
+						cos[k] = (k % 2 == 0) ? f : -f;
+						f /= T(double((2 * k + 5) * (2 * k + 6)));
+					}
+
+					//1 / (k + 2)!
+					f = T(1.0);
+					for (std::size_t k = 0; k < expm1_terms.first; ++k) {
+						f /= T(double(k + 2));
+						expm1[k] = f;
+					}
+
+					for (std::size_t k = 0; k < log_terms.first; ++k) {
+						log[k] = T(2.0) / T(double(2 * k + 3));
+					}
+
+					for (std::size_t k = 0; k < atan_terms.first; ++k) {
+						atan[k] = ((k % 2 == 0) ? T(-1.0) : T(1.0)) / T(double(2 * k + 3));
+					}
+				}
+			};
+
+			template<typename T, int Digits>
+			inline constexpr kernel_series<T, Digits> kernel_series_v{};
+
+			/**
+			* @brief 多項式c[first] + c[first + 1] * x + c[first + 2] * x^2 + ...をHorner法で計算する
+			* @detail 係数の数は固定なので、定数式でもループ回数はデータに依存しない
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto polynomial(T x, const T(&c)[N], std::size_t first = 0) -> T {
+				T r = c[N - 1];
+				for (std::size_t i = N - 1; first < i; --i) {
+					r = r * x + c[i - 1];
+				}
+				return r;
+			}
+
+			/**
+			* @brief kernel_seriesの係数の多項式、head番目以降の項は上位の型で計算する
+			* @param head 上位の型で計算してよい項の先頭
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto split_polynomial(T x, const T(&c)[N], std::size_t first, std::size_t head) -> T {
+				using U = typename upper_type<T>::type;
+
+				if constexpr (std::is_same_v<U, T>) {
+					return detail::polynomial(x, c, first);
+				} else {
+					const std::size_t h = (head < first) ? first : head;
+					if (N <= h) return detail::polynomial(x, c, first);
+
+					const U xu = U(x);
+					U tail = U(c[N - 1]);
+					for (std::size_t i = N - 1; h < i; --i) {
+						tail = tail * xu + U(c[i - 1]);
+					}
+
+					T r = T(tail);
+					for (std::size_t i = h; first < i; --i) {
+						r = r * x + c[i - 1];
+					}
+					return r;
+				}
+			}
+
+			/**
+			* @brief [-pi/4, pi/4]におけるsin, cosの最良近似多項式の係数
+			* @detail sin(x) = x + x^3 * (S1 + S2 * x^2 + ...)
+			* @detail cos(x) = 1 - x^2 / 2 + x^4 * (C1 + C2 * x^2 + ...)
+			* @detail 仮数部の桁数毎に用意し、無い場合はマクローリン級数で計算する
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			struct sin_cos_minimax {
+				static constexpr bool available = false;
+			};
+
+			//float、相対誤差 sin:2^-28, cos:2^-33
+			template<typename T>
+			struct sin_cos_minimax<T, 24> {
+				static constexpr bool available = true;
+
+				static constexpr T sin[] = {
+					T(-1.666665461e-01L), T(8.332160762e-03L), T(-1.951528319e-04L)
+				};
+
+				static constexpr T cos[] = {
+					T(4.166664568e-02L), T(-1.388731625e-03L), T(2.443315705e-05L)
+				};
+			};
+
+			//double、相対誤差 sin:2^-58, cos:2^-58（fdlibmより）
+			template<typename T>
+			struct sin_cos_minimax<T, 53> {
+				static constexpr bool available = true;
+
+				static constexpr T sin[] = {
+					T(-1.66666666666666324348e-01L), T(8.33333333332248946124e-03L), T(-1.98412698298579493134e-04L),
+					T(2.75573137070700676789e-06L), T(-2.50507602534068634195e-08L), T(1.58969099521155010221e-10L)
+				};
+
+				static constexpr T cos[] = {
+					T(4.16666666666666019037e-02L), T(-1.38888888888741095749e-03L), T(2.48015872894767294178e-05L),
+					T(-2.75573143513906633035e-07L), T(2.08757232129817482790e-09L), T(-1.13596475577881948265e-11L)
+				};
+			};
+
+			//x87拡張倍精度、相対誤差 sin:2^-79, cos:2^-74
+			template<typename T>
+			struct sin_cos_minimax<T, 64> {
+				static constexpr bool available = true;
+
+				static constexpr T sin[] = {
+					T(-1.666666666666666666665e-1L), T(8.333333333333333325527e-3L), T(-1.984126984126982734696e-4L),
+					T(2.755731922397386722365e-6L), T(-2.505210837969205283514e-8L), T(1.605904223330245954998e-10L),
+					T(-7.646904119155923998532e-13L), T(2.788835268451540756644e-15L)
+				};
+
+				static constexpr T cos[] = {
+					T(4.166666666666666660905e-2L), T(-1.388888888888887299374e-3L), T(2.480158730157055230499e-5L),
+					T(-2.755731921499978797981e-7L), T(2.087675428708152175842e-9L), T(-1.147028484342535977199e-11L),
+					T(4.737750796424620754619e-14L)
+				};
+			};
+
+			//4倍精度、相対誤差 sin:2^-127, cos:2^-121
+			template<typename T>
+			struct sin_cos_minimax<T, 113> {
+				static constexpr bool available = true;
+
+				static constexpr T sin[] = {
+					T(-1.666666666666666666666666666666666647e-1L), T(8.333333333333333333333333333333119885e-3L),
+					T(-1.984126984126984126984126984045294307e-4L), T(2.755731922398589065255731765498970229e-6L),
+					T(-2.505210838544171877505034150892718987e-8L), T(1.605904383682161459812515654689381820e-10L),
+					T(-7.647163731819815869711749832525282568e-13L), T(2.811457254345322887443567818826504538e-15L),
+					T(-8.220635246181818130363584797826559125e-18L), T(1.957294039628045841453983326491075733e-20L),
+					T(-3.868105354403061800191729405576925553e-23L), T(6.410290407009322350568469307864144299e-26L)
+				};
+
+				static constexpr T cos[] = {
+					T(4.166666666666666666666666666666459301e-2L), T(-1.388888888888888888888888888765724370e-3L),
+					T(2.480158730158730158730158440896460986e-5L), T(-2.755731922398589065255365968069663550e-7L),
+					T(2.087675698786809897637922199915531642e-9L), T(-1.147074559772972328629102712312282003e-11L),
+					T(4.779477332386900932513461302865175712e-14L), T(-1.561920696747074515858102227754469579e-16L),
+					T(4.110317451243693957019403043560663496e-19L), T(-8.896621117922245383631383923228001577e-22L),
+					T(1.601961934245870249920081695792556977e-24L)
+				};
+			};
+
+			/**
+			* @brief sin(x) = x + x^3 * (S1 + z * r)のS1とr（z = x^2）、最良近似が無い精度はマクローリン級数
+			*/
+			template<typename T, int Digits>
+			SPOOK_CONSTEVAL auto sin_polynomial(T z) -> std::pair<T, T> {
+				using coeff = sin_cos_minimax<T, Digits>;
+
+				if constexpr (coeff::available) {
+					return { coeff::sin[0], detail::polynomial(z, coeff::sin, 1) };
+				} else {
+					const auto& series = kernel_series_v<T, Digits>;
+					return { series.sin[0], detail::split_polynomial(z, series.sin, 1, series.sin_terms.second) };
+				}
+			}
+
+			/**
+			* @brief cos(x) = 1 - z / 2 + z * rのr（z = x^2）、最良近似が無い精度はマクローリン級数
+			*/
+			template<typename T, int Digits>
+			SPOOK_CONSTEVAL auto cos_polynomial(T z) -> T {
+				using coeff = sin_cos_minimax<T, Digits>;
+
+				if constexpr (coeff::available) {
+					return z * detail::polynomial(z, coeff::cos);
+				} else {
+					const auto& series = kernel_series_v<T, Digits>;
+					return z * detail::split_polynomial(z, series.cos, 0, series.cos_terms.second);
+				}
+			}
+
+			/**
+			* @brief [-pi/4, pi/4]におけるsin(x + y)
+			* @param x 還元された引数の上位
+			* @param y 還元された引数の下位（|y| < ulp(x) / 2）
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto sin_kernel(T x, T y) -> T {
+				const T z = x * x;
+				const T v = z * x;
+				const auto [s1, r] = detail::sin_polynomial<T, Digits>(z);
+
+				//x + v * (S1 + z * r) + y * cos(x)を、打ち消しが起きないように並べ替えたもの
+				return x - ((z * (T(0.5) * y - v * r) - y) - v * s1);
+			}
+
+			/**
+			* @brief [-pi/4, pi/4]におけるcos(x + y)
+			* @param x 還元された引数の上位
+			* @param y 還元された引数の下位（|y| < ulp(x) / 2）
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto cos_kernel(T x, T y) -> T {
+				const T z = x * x;
+				const T r = detail::cos_polynomial<T, Digits>(z);
+
+				//1 - z / 2の丸め誤差を拾い直す
+				const T hz = T(0.5) * z;
+				const T w = T(1.0) - hz;
+
+				return w + (((T(1.0) - w) - hz) + (z * r - x * y));
+			}
+
+			/**
+			* @brief [-pi/4, pi/4]におけるsin(x + y)を2つの値で計算する
+			* @detail sin_kernelの最後の加算の丸め誤差を下位に残す
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto sin_kernel_parts(T x, T y) -> std::pair<T, T> {
+				const T z = x * x;
+				const T v = z * x;
+				const auto [s1, r] = detail::sin_polynomial<T, spook::numeric_limits_traits<T>::digits>(z);
+
+				return detail::fast_two_sum(x, -((z * (T(0.5) * y - v * r) - y) - v * s1));
+			}
+
+			/**
+			* @brief [-pi/4, pi/4]におけるcos(x + y)を2つの値で計算する
+			* @detail x^2の丸め誤差と最後の加算の丸め誤差を下位に残す
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto cos_kernel_parts(T x, T y) -> std::pair<T, T> {
+				const auto [z, z_lo] = detail::two_prod(x, x);
+				const T r = detail::cos_polynomial<T, spook::numeric_limits_traits<T>::digits>(z);
+
+				const T hz = T(0.5) * z;
+				const T w = T(1.0) - hz;
+
+				return detail::fast_two_sum(w, ((T(1.0) - w) - hz) + (z * r - (x * y + T(0.5) * z_lo)));
+			}
+
+			/**
+			* @brief 上位と下位に分かれた値を、より広い型Uの1つの値にする
+			*/
+			template<typename U, typename T>
+			SPOOK_CONSTEVAL auto join_parts(T hi, T lo) -> U {
+				if constexpr (std::is_same_v<U, double_double::dd<T>>) {
+					return U::from_parts(hi, lo);
+				} else {
+					return U(hi) + U(lo);
+				}
+			}
+
+			/**
+			* @brief dd<U>の値を、より狭い型Tへ正しく丸める
+			* @detail hiをTへ丸めた値は、hiがTの隣り合う2値の中点ちょうどの時だけloの符号によって隣の値と入れ替わる
+			*/
+			template<typename T, typename U>
+			SPOOK_CONSTEVAL auto round_parts(const double_double::dd<U>& v) -> T {
+				const T n = T(v.hi);
+				if (!spook::isfinite(n) || spook::iszero(v.lo)) return n;
+
+				//Tに近い値との差は誤差なく求まる
+				const U rest = v.hi - U(n);
+				if (spook::iszero(rest)) return n;
+
+				const T inf = spook::numeric_limits_traits<T>::infinity();
+				const T next = spook::nextafter(n, (rest < U(0.0)) ? -inf : inf);
+
+				if (rest + rest == U(next) - U(n) && (U(0.0) < rest) == (U(0.0) < v.lo)) return next;
+				return n;
+			}
+
+			/**
+			* @brief 広い型Uで計算した値をTへ丸める
+			* @detail Uが組み込み型（floatに対するdouble）なら、Uでの誤差の範囲が丸めの境界を跨ぐ時だけ、
+			*         dd<U>で計算し直して丸める。2回の丸めで誤って丸めることはない
+			* @param wide faithful_tでUで計算した値、誤差は数ulp（tanとpowで最大3ulp程度）
+			* @param wider dd<U>で計算した値を返す関数
+			*/
+			template<typename T, typename Policy, typename U, typename F>
+			SPOOK_CONSTEVAL auto round_wide(U wide, F wider) -> T {
+				if constexpr (use_rounding_type<U, Policy>) {
+					if (spook::isfinite(wide)) {
+						//wideの誤差に余裕を見込んで16ulpずらす
+						const U margin = spook::fabs(wide) * detail::scale2(U(1.0), 5 - spook::numeric_limits_traits<U>::digits);
+						const T n = T(wide);
+
+						if (T(wide - margin) != n || T(wide + margin) != n) return detail::round_parts<T>(wider());
+						return n;
+					}
+				}
+
+				return T(wide);
+			}
+
+			/**
+			* @brief Tで還元した角度hi + loについて、方針に応じた型と多項式でsinを計算する
+			* @detail 還元はTのままでも上位と下位でTの2倍近い精度があるので、広い型では多項式だけを評価する
+			*/
+			template<typename Policy, typename T>
+			SPOOK_CONSTEVAL auto sin_reduced(T hi, T lo) -> evaluation_t<T, Policy> {
+				if constexpr (use_rounding_type<T, Policy>) {
+					using U = evaluation_t<T, Policy>;
+					return detail::sin_kernel(detail::join_parts<U>(hi, lo), U{});
+				} else {
+					return detail::sin_kernel<T, kernel_digits<T, Policy>>(hi, lo);
+				}
+			}
+
+			/**
+			* @brief Tで還元した角度hi + loについて、方針に応じた型と多項式でcosを計算する
+			*/
+			template<typename Policy, typename T>
+			SPOOK_CONSTEVAL auto cos_reduced(T hi, T lo) -> evaluation_t<T, Policy> {
+				if constexpr (use_rounding_type<T, Policy>) {
+					using U = evaluation_t<T, Policy>;
+					return detail::cos_kernel(detail::join_parts<U>(hi, lo), U{});
+				} else {
+					return detail::cos_kernel<T, kernel_digits<T, Policy>>(hi, lo);
+				}
+			}
+		}
+
+		/**
+		* @brief 精度の方針を指定したsin
+		* @param arg θ[rad]
+		* @param Policy fast_t, faithful_t, correctly_rounded_tのいずれか
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto sin(T arg, Policy) -> T {
+			if (detail::has_special_values<T>) {
+				if (arg == 0.0) return arg;
+				if (spook::isinf(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+				if (spook::isnan(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+			}
+
+			if constexpr (detail::use_rounding_type<detail::evaluation_t<T, Policy>, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::sin(U(arg), spook::faithful), [arg] { return spook::sin(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); });
+			}
+
+			const auto r = detail::reduce_pi_over_2(arg);
+
+			//象限に応じてsin, cosを選ぶ
+			switch (r.quadrant) {
+			case 0:  return T( detail::sin_reduced<Policy>(r.hi, r.lo));
+			case 1:  return T( detail::cos_reduced<Policy>(r.hi, r.lo));
+			case 2:  return T(-detail::sin_reduced<Policy>(r.hi, r.lo));
+			default: return T(-detail::cos_reduced<Policy>(r.hi, r.lo));
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto sin(T arg) -> T {
+			return spook::sin(arg, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定したcos
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto cos(T arg, Policy) -> T {
+			if (detail::has_special_values<T>) {
+				if (arg == 0.0) return 1.0;
+				if (spook::isinf(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+				if (spook::isnan(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+			}
+
+			if constexpr (detail::use_rounding_type<detail::evaluation_t<T, Policy>, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::cos(U(arg), spook::faithful), [arg] { return spook::cos(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); });
+			}
+
+			const auto r = detail::reduce_pi_over_2(arg);
+
+			//象限に応じてsin, cosを選ぶ
+			switch (r.quadrant) {
+			case 0:  return T( detail::cos_reduced<Policy>(r.hi, r.lo));
+			case 1:  return T(-detail::sin_reduced<Policy>(r.hi, r.lo));
+			case 2:  return T(-detail::cos_reduced<Policy>(r.hi, r.lo));
+			default: return T( detail::sin_reduced<Policy>(r.hi, r.lo));
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto cos(T arg) -> T {
+			return spook::cos(arg, spook::faithful);
+		}
+
+		/**
+		* @brief sin(arg)とcos(arg)を同時に計算する
+		* @detail 引数の還元を1度だけ行い、両方の多項式を評価する
+		* @param arg θ[rad]
+		* @param Policy fast_t, faithful_t, correctly_rounded_tのいずれか
+		* @return {sin(arg), cos(arg)}
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto sincos(T arg, Policy) -> std::pair<T, T> {
+			if (detail::has_special_values<T>) {
+				if (arg == 0.0) return { arg, T(1.0) };
+				if (spook::isinf(arg) || spook::isnan(arg)) {
+					return { spook::numeric_limits_traits<T>::quiet_NaN(), spook::numeric_limits_traits<T>::quiet_NaN() };
+				}
+			}
+
+			if constexpr (detail::use_rounding_type<detail::evaluation_t<T, Policy>, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				const auto [s, c] = spook::sincos(U(arg), spook::faithful);
+				const auto wider = [arg] { return spook::sincos(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); };
+
+				return { detail::round_wide<T, Policy>(s, [&wider] { return wider().first; }), detail::round_wide<T, Policy>(c, [&wider] { return wider().second; }) };
+			}
+
+			const auto r = detail::reduce_pi_over_2(arg);
+
+			const T sin_v = T(detail::sin_reduced<Policy>(r.hi, r.lo));
+			const T cos_v = T(detail::cos_reduced<Policy>(r.hi, r.lo));
+
+			//象限に応じて入れ替える
+			switch (r.quadrant) {
+			case 0:  return {  sin_v,  cos_v };
+			case 1:  return {  cos_v, -sin_v };
+			case 2:  return { -sin_v, -cos_v };
+			default: return { -cos_v,  sin_v };
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto sincos(T arg) -> std::pair<T, T> {
+			return spook::sincos(arg, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定したtan
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto tan(T arg, Policy) -> T {
+			if (detail::has_special_values<T>) {
+				if (arg == 0.0) return arg;
+				if (spook::isinf(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+				if (spook::isnan(arg)) return spook::numeric_limits_traits<T>::quiet_NaN();
+			}
+
+			if constexpr (detail::use_rounding_type<detail::evaluation_t<T, Policy>, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::tan(U(arg), spook::faithful), [arg] { return spook::tan(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); });
+			}
+
+			const auto r = detail::reduce_pi_over_2(arg);
+
+			//correctly_rounded_tでは、割り算もdd<T>のまま行ってから丸める
+			const auto sin_v = detail::sin_reduced<Policy>(r.hi, r.lo);
+			const auto cos_v = detail::cos_reduced<Policy>(r.hi, r.lo);
+
+			//pi/2の奇数倍ずれている時は-cotになる
+			return T((r.quadrant & 1) ? -cos_v / sin_v : sin_v / cos_v);
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto tan(T arg) -> T {
+			return spook::tan(arg, spook::faithful);
+		}
+
+		namespace detail {
+
+			/**
+			* @brief log(2)の2進展開（32bit毎、先頭の最上位ビットが小数第1位）
+			*/
+			inline constexpr std::uint32_t ln2_bits[] = {
+				0xB17217F7, 0xD1CF79AB, 0xC9E3B398, 0x03F2F6AF, 0x40F34326, 0x7298B62D, 0x8A0D175B, 0x8BAAFA2B,
+				0xE7B87620, 0x6DEBAC98, 0x559552FB, 0x4AFA1B10,
+			};
+
+			/**
+			* @brief log(10)の2進展開（32bit毎、先頭の最上位ビットが2^1の位）
+			*/
+			inline constexpr std::uint32_t ln10_bits[] = {
+				0x935D8DDD, 0xAAA8AC16, 0xEA56D62B, 0x82D30A28, 0xE28FECF9, 0xDA5DF90E, 0x83C61E82, 0x01F02D72,
+				0x962F02D7, 0xB1A8105C, 0xCC70CBC0, 0x2C5F0D68,
+			};
+
+			/**
+			* @brief 指数関数の還元で使用する定数
+			* @detail ln2_hiはdigits - k_bitsビットで、k_bitsビット以下の整数との積が丸められない
+			*/
+			template<typename T>
+			struct exp_constants {
+				using limits = spook::numeric_limits_traits<T>;
+
+				static constexpr int digits = limits::digits;
+				//2^kのkが取りうる範囲（非正規化数を含む）のビット数
+				static constexpr int k_bits = [] {
+					int bits = 0;
+					for (int range = limits::max_exponent - limits::min_exponent + limits::digits + 2; 0 < range; range >>= 1) ++bits;
+					return bits;
+				}();
+
+				static constexpr T ln2_hi = detail::from_bits<T>(ln2_bits, 0, digits - k_bits, -1);
+				static constexpr T ln2_lo = detail::from_bits<T>(ln2_bits, digits - k_bits, digits, -1);
+
+				static constexpr T ln2 = detail::from_bits<T>(ln2_bits, 0, digits, -1);
+				static constexpr T ln2_tail = detail::from_bits<T>(ln2_bits, digits, digits, -1);
+				static constexpr T ln10 = detail::from_bits<T>(ln10_bits, 0, digits, 1);
+				static constexpr T ln10_tail = detail::from_bits<T>(ln10_bits, digits, digits, 1);
+
+				static constexpr T log2_e = T(1.0) / ln2;
+				static constexpr T log2_10 = ln10 / ln2;
+			};
+
+			/**
+			* @brief [-log(2)/2, log(2)/2]におけるexpの最良近似多項式の係数
+			* @detail r * (exp(r) + 1) / (exp(r) - 1) = 2 + r^2 * (P1 + P2 * r^2 + ...)
+			* @detail 仮数部の桁数毎に用意し、無い場合はマクローリン級数で計算する
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			struct exp_minimax {
+				static constexpr bool available = false;
+			};
+
+			//float、誤差 2^-27
+			template<typename T>
+			struct exp_minimax<T, 24> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(1.6666625759e-01L), T(-2.7667556574e-03L)
+				};
+			};
+
+			//double、誤差 2^-59（fdlibmより）
+			template<typename T>
+			struct exp_minimax<T, 53> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(1.66666666666666019037e-01L), T(-2.77777777770155933842e-03L), T(6.61375632143793436117e-05L),
+					T(-1.65339022054652515390e-06L), T(4.13813679705723846039e-08L)
+				};
+			};
+
+			//x87拡張倍精度、誤差 2^-69
+			template<typename T>
+			struct exp_minimax<T, 64> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(1.666666666666666660085e-1L), T(-2.777777777777671198357e-3L), T(6.613756613181888593416e-5L),
+					T(-1.653439010929971469779e-6L), T(4.175172675425475363281e-8L), T(-1.045800875792089708218e-9L)
+				};
+			};
+
+			//4倍精度、誤差 2^-121
+			template<typename T>
+			struct exp_minimax<T, 113> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(1.666666666666666666666666666666661945e-1L), T(-2.777777777777777777777777777549931902e-3L),
+					T(6.613756613756613756613752791511018125e-5L), T(-1.653439153439153439150241388181121748e-6L),
+					T(4.175351397573619780297662859894012765e-8L), T(-1.056838027737493885357144721116622136e-9L),
+					T(2.676507306127419423780615046852104729e-11L), T(-6.779360579968216900000174200355799358e-13L),
+					T(1.717211297833694762342906866045784873e-14L), T(-4.349117746463703866157074453896493197e-16L),
+					T(1.081978161724640534335243603212625066e-17L)
+				};
+			};
+
+			/**
+			* @brief 最も近い整数へ丸める（intに収まること）
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto nearest_int(T x) -> int {
+				return static_cast<int>(x < T(0.0) ? x - T(0.5) : x + T(0.5));
+			}
+
+			/**
+			* @brief x = k * log(2) + (hi + lo)に還元された指数関数の引数
+			*/
+			template<typename T>
+			struct reduced_exponent {
+				T hi;   //[-log(2)/2, log(2)/2]に還元された値の上位
+				T lo;   //[-log(2)/2, log(2)/2]に還元された値の下位
+				int k;  //2の冪
+			};
+
+			/**
+			* @brief x - fk * log(2)を上位と下位の2つの値で計算する
+			* @param fk x / log(2)に最も近い整数
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto ln2_remainder(T x, T fk) -> std::pair<T, T> {
+				using c = exp_constants<T>;
+
+				//x - k * ln2_hiは丸められない
+				return detail::fast_two_sum(x - fk * c::ln2_hi, -(fk * c::ln2_lo));
+			}
+
+			/**
+			* @brief Cody-Waiteの方法で、xをk * log(2) + rに還元する
+			* @param x |x| < 2^k_bits * log(2)であること
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto reduce_ln2(T x) -> reduced_exponent<T> {
+				const int k = detail::nearest_int(x * exp_constants<T>::log2_e);
+				const auto [hi, lo] = detail::ln2_remainder(x, T(k));
+
+				return { hi, lo, k };
+			}
+
+			/**
+			* @brief [-log(2)/2, log(2)/2]におけるexp(hi + lo) - 1
+			* @param hi 還元された引数の上位
+			* @param lo 還元された引数の下位（|lo| < ulp(hi) / 2）
+			* @return {上位, 下位}、足し合わせる前の2つの値
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto expm1_kernel(T hi, T lo) -> std::pair<T, T> {
+				using coeff = exp_minimax<T, Digits>;
+
+				const T r = hi + lo;
+
+				if constexpr (coeff::available) {
+					//R(r) = r * (exp(r) + 1) / (exp(r) - 1)として、exp(r) - 1 = r + r * c / (2 - c)、c = r - (R(r) - 2)
+					const T z = r * r;
+					const T c = r - z * detail::polynomial(z, coeff::p);
+
+					return { hi, lo + (r * c) / (T(2.0) - c) };
+				} else {
+					const auto& c = kernel_series_v<T, Digits>;
+					const T series = r + r * (r * detail::split_polynomial(r, c.expm1, 0, c.expm1_terms.second));
+
+					return { series, ((hi - r) + lo) * (T(1.0) + series) };
+				}
+			}
+
+			/**
+			* @brief a + (hi + lo)を、hiとの和の丸め誤差を拾って計算する
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto add_parts(T a, const std::pair<T, T>& parts) -> T {
+				const auto [s, e] = detail::two_sum(a, parts.first);
+				return s + (e + parts.second);
+			}
+
+			/**
+			* @brief 2^kを掛けてもオーバー/アンダーフローしない指数の範囲か
+			* @param x log2(結果)の概算
+			* @return オーバーフローなら1、アンダーフローなら-1、それ以外は0
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto exp_range(T x) -> int {
+				using limits = spook::numeric_limits_traits<T>;
+
+				if (T(limits::max_exponent + 1) < x) return 1;
+				if (x < T(limits::min_exponent - limits::digits - 2)) return -1;
+				return 0;
+			}
+
+			/**
+			* @brief exp(hi + lo)を計算する
+			* @param hi 有限値
+			* @param lo |lo| < ulp(hi)程度の補正値
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto exp_sum(T hi, T lo) -> T {
+				using limits = spook::numeric_limits_traits<T>;
+
+				//2^kのkがintに収まらない範囲
+				switch (detail::exp_range(hi * detail::exp_constants<T>::log2_e)) {
+				case 1:  return limits::infinity();
+				case -1: return T(+0.0);
+				}
+
+				//exp(x) = 2^k * exp(r)
+				const auto r = detail::reduce_ln2(hi);
+				const auto [r_hi, r_lo] = detail::fast_two_sum(r.hi, r.lo + lo);
+
+				return spook::ldexp(detail::add_parts(T(1.0), detail::expm1_kernel<T, Digits>(r_hi, r_lo)), r.k);
+			}
+
+			/**
+			* @brief exp(x) - 1を上位と下位の2つの値で計算する
+			* @param x [0, (digits + 2) * log(2)]であること
+			* @return {上位, 下位}、|下位| <= ulp(上位) / 2
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto expm1_parts(T x) -> std::pair<T, T> {
+				const auto r = detail::reduce_ln2(x);
+				const auto [hi, lo] = detail::expm1_kernel(r.hi, r.lo);
+
+				if (r.k == 0) return detail::fast_two_sum(hi, lo);
+
+				//2^k * ((1 - 2^-k) + e)、1 - 2^-kはk <= digitsなら丸められず、それより大きければ無視できる
+				const T scale = detail::pow2<T>(r.k);
+				const auto [s, e] = detail::two_sum(T(1.0) - detail::pow2<T>(-r.k), hi);
+
+				return detail::fast_two_sum(s * scale, (e + lo) * scale);
+			}
+		}
+
+		/**
+		* @brief 精度の方針を指定したexp
+		* @param Policy fast_t, faithful_t, correctly_rounded_tのいずれか
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto exp(T arg, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if (detail::has_special_values<T>) {
+				if (arg == T(0.0)) return T(1.0);
+				if (spook::isnan(arg)) return limits::quiet_NaN();
+				if (spook::isinf(arg)) {
+					if (spook::signbit(arg)) return T(+0.0);
+					return arg;
+				}
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::exp(U(arg), spook::faithful), [arg] { return spook::exp(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); });
+			} else {
+				return detail::exp_sum<T, detail::kernel_digits<T, Policy>>(arg, T(0.0));
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto exp(T arg) -> T {
+			return spook::exp(arg, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定したexp2
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto exp2(T arg, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::exp_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (arg == T(0.0)) return T(1.0);
+				if (spook::isnan(arg)) return limits::quiet_NaN();
+				if (spook::isinf(arg)) {
+					if (spook::signbit(arg)) return T(+0.0);
+					return arg;
+				}
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::exp2(U(arg), spook::faithful), [arg] { return spook::exp2(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); });
+			} else {
+				switch (detail::exp_range(arg)) {
+				case 1:  return limits::infinity();
+				case -1: return T(+0.0);
+				}
+
+				//2^x = 2^k * exp(f * log(2))、fは丸められない
+				const int k = detail::nearest_int(arg);
+				const T f = arg - T(k);
+
+				const auto [hi, lo] = detail::two_prod(f, c::ln2);
+				const auto [r_hi, r_lo] = detail::fast_two_sum(hi, lo + f * c::ln2_tail);
+
+				return spook::ldexp(detail::add_parts(T(1.0), detail::expm1_kernel<T, detail::kernel_digits<T, Policy>>(r_hi, r_lo)), k);
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto exp2(T arg) -> T {
+			return spook::exp2(arg, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定したexp10
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto exp10(T arg, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::exp_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (arg == T(0.0)) return T(1.0);
+				if (spook::isnan(arg)) return limits::quiet_NaN();
+				if (spook::isinf(arg)) {
+					if (spook::signbit(arg)) return T(+0.0);
+					return arg;
+				}
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::exp10(U(arg), spook::faithful), [arg] { return spook::exp10(detail::evaluation_t<U, Policy>(U(arg)), spook::faithful); });
+			} else {
+				switch (detail::exp_range(arg * c::log2_10)) {
+				case 1:  return limits::infinity();
+				case -1: return T(+0.0);
+				}
+
+				//10^x = 2^k * exp(x * log(10) - k * log(2))、x * log(10)は2つに分けて持つ
+				const int k = detail::nearest_int(arg * c::log2_10);
+				const T fk = T(k);
+
+				const auto [p, e] = detail::two_prod(arg, c::ln10);
+				const auto [hi, lo] = detail::fast_two_sum(p - fk * c::ln2_hi, (e + arg * c::ln10_tail) - fk * c::ln2_lo);
+
+				return spook::ldexp(detail::add_parts(T(1.0), detail::expm1_kernel<T, detail::kernel_digits<T, Policy>>(hi, lo)), k);
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto exp10(T arg) -> T {
+			return spook::exp10(arg, spook::faithful);
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto expm1(T arg) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::exp_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (arg == T(0.0)) return arg;
+				if (spook::isnan(arg)) return limits::quiet_NaN();
+				if (spook::isinf(arg)) {
+					if (spook::signbit(arg)) return T(-1.0);
+					return arg;
+				}
+			}
+
+			const T log2_v = arg * c::log2_e;
+			if (detail::exp_range(log2_v) == 1) return limits::infinity();
+			//exp(x)が1の半ulpに満たない
+			if (log2_v < -T(c::digits + 2)) return T(-1.0);
+
+			const auto r = detail::reduce_ln2(arg);
+			const auto e = detail::expm1_kernel(r.hi, r.lo);
+
+			if (r.k == 0) return e.first + e.second;
+
+			if (r.k < -1 || c::digits < r.k) {
+				//2^k * (1 + e) - 1、1かeのどちらかが無視できる
+				return spook::ldexp(detail::add_parts(T(1.0), e), r.k) - T(1.0);
+			}
+
+			//2^k * ((1 - 2^-k) + e)、1 - 2^-kは丸められない
+			return spook::ldexp(detail::add_parts(T(1.0) - spook::ldexp(T(1.0), -r.k), e), r.k);
+		}
+
+
+		namespace detail {
+
+			/**
+			* @brief log2(e)の2進展開（32bit毎、先頭の最上位ビットが2^0の位）
+			*/
+			inline constexpr std::uint32_t log2_e_bits[] = {
+				0xB8AA3B29, 0x5C17F0BB, 0xBE87FED0, 0x691D3E88, 0xEB577AA8, 0xDD695A58, 0x8B25166C, 0xD1A13247,
+				0xDE1C43F7, 0x55176CD6, 0x24D92F75, 0xC16BE0B3,
+			};
+
+			/**
+			* @brief log10(e)の2進展開（32bit毎、先頭の最上位ビットが小数第2位）
+			*/
+			inline constexpr std::uint32_t log10_e_bits[] = {
+				0xDE5BD8A9, 0x37287195, 0x355BAAAF, 0xAD33DC32, 0x3EE34602, 0x45C9A202, 0x3A3F2D44, 0xF78EA53C,
+				0x75424EFA, 0x1402F3F2, 0x92235592, 0xC6464A15,
+			};
+
+			/**
+			* @brief log10(2)の2進展開（32bit毎、先頭の最上位ビットが小数第2位）
+			*/
+			inline constexpr std::uint32_t log10_2_bits[] = {
+				0x9A209A84, 0xFBCFF798, 0x8F8959AC, 0x0B7C9178, 0x26AD30C5, 0x43D1F349, 0x8A5E6F26, 0xB7CC63CB,
+				0x286A2D81, 0x919FABD0, 0x9E5CBC73, 0x3471BD12,
+			};
+
+			/**
+			* @brief 対数関数で使用する定数
+			* @detail 底の変換に使う定数は、上位digitsビットと残りに分けて持つ
+			*/
+			template<typename T>
+			struct log_constants {
+				static constexpr int digits = spook::numeric_limits_traits<T>::digits;
+
+				static constexpr T log2_e = detail::from_bits<T>(log2_e_bits, 0, digits, 0);
+				static constexpr T log2_e_tail = detail::from_bits<T>(log2_e_bits, digits, digits, 0);
+				static constexpr T log10_e = detail::from_bits<T>(log10_e_bits, 0, digits, -2);
+				static constexpr T log10_e_tail = detail::from_bits<T>(log10_e_bits, digits, digits, -2);
+				static constexpr T log10_2 = detail::from_bits<T>(log10_2_bits, 0, digits, -2);
+				static constexpr T log10_2_tail = detail::from_bits<T>(log10_2_bits, digits, digits, -2);
+
+				//仮数を[sqrt(2)/2, sqrt(2))に収める境界
+				static constexpr T sqrt2 = T(1.41421356237309504880168872420969807857L);
+			};
+
+			/**
+			* @brief [sqrt(2)/2 - 1, sqrt(2) - 1]におけるlog(1 + f)の最良近似多項式の係数
+			* @detail s = f / (2 + f)、z = s^2として、log(1 + f) = 2s + s * z * (P1 + P2 * z + ...)
+			* @detail 仮数部の桁数毎に用意し、無い場合はatanhの級数で計算する
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			struct log_minimax {
+				static constexpr bool available = false;
+			};
+
+			//float、誤差 2^-37
+			template<typename T>
+			struct log_minimax<T, 24> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(6.6666665645e-01L), T(4.0000335191e-01L), T(2.8537308542e-01L), T(2.3582151299e-01L)
+				};
+			};
+
+			//double、誤差 2^-58（fdlibmより）
+			template<typename T>
+			struct log_minimax<T, 53> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(6.666666666666735130e-01L), T(3.999999999940941908e-01L), T(2.857142874366239149e-01L), T(2.222219843214978396e-01L),
+					T(1.818357216161805012e-01L), T(1.531383769920937332e-01L), T(1.479819860511658591e-01L)
+				};
+			};
+
+			//x87拡張倍精度、誤差 2^-73
+			template<typename T>
+			struct log_minimax<T, 64> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(6.66666666666666667138e-01L), T(3.99999999999999359155e-01L), T(2.85714285714585499354e-01L),
+					T(2.22222222153504450572e-01L), T(1.81818190720826090178e-01L), T(1.53845458298067121850e-01L),
+					T(1.33366722636139244669e-01L), T(1.16686303813662954111e-01L), T(1.20342050288153109105e-01L)
+				};
+			};
+
+			//4倍精度、誤差 2^-123
+			template<typename T>
+			struct log_minimax<T, 113> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(6.666666666666666666666666666666665630e-01L), T(4.000000000000000000000000000004104294e-01L),
+					T(2.857142857142857142857142800062635204e-01L), T(2.222222222222222222222262552433047307e-01L),
+					T(1.818181818181818181801159509606607936e-01L), T(1.538461538461538466236714699583299790e-01L),
+					T(1.333333333333332436543034156086781032e-01L), T(1.176470588235416837610089391254892072e-01L),
+					T(1.052631578935051934442154164771475649e-01L), T(9.523809532991564446507974364933912409e-02L),
+					T(8.695651663371900669242850943723562658e-02L), T(8.000021070140233367340891402552096073e-02L),
+					T(7.406771972188237874211884337108305308e-02L), T(6.910123505304862444021001123372903672e-02L),
+					T(6.258117261226033698697082627151605755e-02L), T(7.689962258607491008124314021624822624e-02L)
+				};
+			};
+
+			/**
+			* @brief [sqrt(2)/2 - 1, sqrt(2) - 1]におけるlog(1 + f)
+			* @return {上位, 下位}、足し合わせる前の2つの値
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto log1p_kernel(T f) -> std::pair<T, T> {
+				using coeff = log_minimax<T, Digits>;
+
+				const T s = f / (T(2.0) + f);
+				const T z = s * s;
+				T r{};
+
+				if constexpr (coeff::available) {
+					r = z * detail::polynomial(z, coeff::p);
+				} else {
+					//2 * atanh(s) / s - 2の級数
+					const auto& c = kernel_series_v<T, Digits>;
+					r = z * detail::split_polynomial(z, c.log, 0, c.log_terms.second);
+				}
+
+				//log(1 + f) = f - f^2 / 2 + s * (f^2 / 2 + R)、f^2 / 2は誤差なしで持つ
+				const auto [sq, sq_err] = detail::two_prod(f, f);
+				const T hfsq = sq * T(0.5);
+				const auto [hi, lo] = detail::fast_two_sum(f, -hfsq);
+
+				return { hi, lo + (s * (hfsq + r) - sq_err * T(0.5)) };
+			}
+
+			/**
+			* @brief 正の有限値xを、x = 2^k * mとなる[sqrt(2)/2, sqrt(2))の仮数mと指数kに分解する
+			* @return {m, k}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto reduce_log(T x) -> std::pair<T, int> {
+				int k = 0;
+				T m = spook::frexp(x, &k);
+
+				//[0.5, 1)を[sqrt(2)/2, sqrt(2))へ
+				if (m < T(0.5) * log_constants<T>::sqrt2) {
+					m *= T(2.0);
+					--k;
+				}
+
+				return { m, k };
+			}
+
+			/**
+			* @brief log(2^k * m)を上位と下位の2つの値で計算する
+			* @param m [sqrt(2)/2, sqrt(2))の仮数
+			* @return {上位, 下位}、|下位| <= ulp(上位) / 2
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto log_reduced(T m, int k) -> std::pair<T, T> {
+				using c = exp_constants<T>;
+
+				const auto [hi, lo] = detail::log1p_kernel<T, Digits>(m - T(1.0));
+
+				if (k == 0) return detail::fast_two_sum(hi, lo);
+
+				//log(x) = k * log(2) + log(m)、k * ln2_hiは丸められない
+				const T fk = T(k);
+				const auto [s, e] = detail::fast_two_sum(fk * c::ln2_hi, hi);
+
+				return detail::fast_two_sum(s, e + (lo + fk * c::ln2_lo));
+			}
+
+			/**
+			* @brief log(x)を上位と下位の2つの値で計算する
+			* @param x 正の有限値
+			* @return {上位, 下位}、|下位| <= ulp(上位) / 2
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto log_parts(T x) -> std::pair<T, T> {
+				const auto [m, k] = detail::reduce_log(x);
+
+				return detail::log_reduced<T, Digits>(m, k);
+			}
+
+			/**
+			* @brief log(1 + (hi + lo))
+			* @param hi -1より大きい有限値
+			* @param lo |lo| <= ulp(hi)程度の補正値
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto log1p_sum(T hi, T lo) -> T {
+				using c = log_constants<T>;
+
+				//1 + hiが[sqrt(2)/2, sqrt(2))の時は、hiをそのまま使う
+				if (T(0.5) * c::sqrt2 - T(1.0) <= hi && hi < c::sqrt2 - T(1.0)) {
+					const auto [k_hi, k_lo] = detail::log1p_kernel(hi);
+					return k_hi + (k_lo + lo / (T(1.0) + hi));
+				}
+
+				//log(1 + x) = log(u) + log(1 + err / u)、u = 1 + hiの丸め誤差errを補正する
+				const auto [u, err] = detail::two_sum(T(1.0), hi);
+				const auto [l_hi, l_lo] = detail::log_parts(u);
+
+				return l_hi + (l_lo + (err + lo) / u);
+			}
+		}
+
+		/**
+		* @brief 精度の方針を指定したlog
+		* @param Policy fast_t, faithful_t, correctly_rounded_tのいずれか
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto log(T x, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x) || x < T(0.0)) return limits::quiet_NaN();
+				if (x == T(0.0)) return -limits::infinity();
+				if (spook::isinf(x)) return x;
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::log(U(x), spook::faithful), [x] { return spook::log(detail::evaluation_t<U, Policy>(U(x)), spook::faithful); });
+			} else {
+				const auto [hi, lo] = detail::log_parts<T, detail::kernel_digits<T, Policy>>(x);
+
+				return hi + lo;
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto log(T x) -> T {
+			return spook::log(x, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定したlog2
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto log2(T x, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::log_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x) || x < T(0.0)) return limits::quiet_NaN();
+				if (x == T(0.0)) return -limits::infinity();
+				if (spook::isinf(x)) return x;
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::log2(U(x), spook::faithful), [x] { return spook::log2(detail::evaluation_t<U, Policy>(U(x)), spook::faithful); });
+			} else {
+				const auto [m, k] = detail::reduce_log(x);
+				const auto [hi, lo] = detail::log1p_kernel<T, detail::kernel_digits<T, Policy>>(m - T(1.0));
+
+				//log2(x) = k + log(m) * log2(e)、2の冪は誤差なしになる
+				const auto [p, pe] = detail::two_prod(hi, c::log2_e);
+				const auto [s, e] = detail::two_sum(T(k), p);
+
+				return s + (e + (pe + (lo * c::log2_e + hi * c::log2_e_tail)));
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto log2(T x) -> T {
+			return spook::log2(x, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定したlog10
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto log10(T x, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::log_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x) || x < T(0.0)) return limits::quiet_NaN();
+				if (x == T(0.0)) return -limits::infinity();
+				if (spook::isinf(x)) return x;
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::log10(U(x), spook::faithful), [x] { return spook::log10(detail::evaluation_t<U, Policy>(U(x)), spook::faithful); });
+			} else {
+				const auto [m, k] = detail::reduce_log(x);
+				const auto [hi, lo] = detail::log1p_kernel<T, detail::kernel_digits<T, Policy>>(m - T(1.0));
+
+				//log10(x) = k * log10(2) + log(m) * log10(e)
+				const T fk = T(k);
+				const auto [a, ae] = detail::two_prod(fk, c::log10_2);
+				const auto [p, pe] = detail::two_prod(hi, c::log10_e);
+				const auto [s, e] = detail::two_sum(a, p);
+
+				return s + (e + ((ae + fk * c::log10_2_tail) + (pe + (lo * c::log10_e + hi * c::log10_e_tail))));
+			}
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto log10(T x) -> T {
+			return spook::log10(x, spook::faithful);
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto log1p(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0)) return x;
+				if (spook::isnan(x) || x < T(-1.0)) return limits::quiet_NaN();
+				if (x == T(-1.0)) return -limits::infinity();
+				if (spook::isinf(x)) return x;
+			}
+
+			return detail::log1p_sum(x, T(0.0));
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 再帰的に2の累乗回の累乗を計算し、それらを適切に掛けることで掛け算回数を減らす
+			* @param x 2の累乗回かけてあるx
+			* @param prev_n 一つ前の冪の数（2の倍数
+			* @param pow_n 掛けるべき回数、関数が戻った後は残りの掛けるべき回数へ変化する
+			* @return 適切な回数かけられた途中結果
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto pow_impl(T x, std::size_t prev_n, std::size_t& pow_n) -> T {
+				//現在のかけた回数
+				std::size_t now_n = prev_n + prev_n;
+
+				if (now_n <= pow_n) {
+					//x^2を計算し、次へ
+					auto powx = pow_impl(x*x, now_n, pow_n);
+					//終わったら、残りのかける回数を調べて必要ならかけて返す
+					if (prev_n <= pow_n) {
+						pow_n -= prev_n;
+						powx *= x;
+					}
+					return powx;
+				}
+				else {
+					//掛けるべき回数を超えた時は一つ前の結果を最大として戻る
+					pow_n -= prev_n;
+					return x;
+				}
+			}
+		}
+
+		/**
+		* @brief 精度の方針を指定したpow
+		* @param Policy fast_t, faithful_t, correctly_rounded_tのいずれか
+		*/
+		template<typename T, typename N, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto pow(T x, N y, Policy) -> T {
+			if constexpr (spook::is_integral_v<N> && detail::use_rounding_type<T, Policy>) {
+				return T(spook::pow(detail::evaluation_t<T, Policy>(x), y, spook::faithful));
+			} else if constexpr (spook::is_integral_v<N>) {
+				//0 < nの所で計算
+				std::size_t n = spook::abs(y);
+
+				if (n == 0)
+					return T(1.0);
+				if (n == 1)
+					return spook::signbit(y) ? T(1.0) / x : x;
+
+				auto x_pow_y = detail::pow_impl(x * x, 2, n);
+
+				//奇数乗の時
+				if (n == 1)
+					x_pow_y *= x;
+
+				//負の冪なら逆数へ
+				return spook::signbit(y) ? T(1.0) / x_pow_y : x_pow_y;
+			} else if constexpr (spook::is_floating_point_v<N>) {
+				//TとNが一致しないならば、仮数部の長い方の型で計算（log(x)とexpは2つの値で持つので、それ以上の型は要らない）
+				using floating_t = std::conditional_t<(spook::numeric_limits_traits<N>::digits < spook::numeric_limits_traits<T>::digits), T, N>;
+
+				const floating_t fx = floating_t(x);
+				const floating_t fy = floating_t(y);
+
+				//0以下、∞、NaNはlogとexpの特別な値に任せる
+				if (!(floating_t(0.0) < fx) || spook::isinf(fx) || !spook::isfinite(fy)) {
+					return T(spook::exp(fy * spook::log(fx)));
+				}
+
+				if constexpr (detail::use_rounding_type<floating_t, Policy>) {
+					using U = detail::evaluation_t<floating_t, Policy>;
+					using V = detail::evaluation_t<U, Policy>;
+
+					//dd<T>のlog(x)は1つの値でも相対誤差が十分小さいので、誤差なしの乗算は要らない
+					const auto wider = [fx, fy] { return spook::exp(V(fy) * spook::log(V(fx), spook::faithful), spook::faithful); };
+
+					//floatはy * log(x)の丸め誤差が残らないdoubleのfaithful_tのpowで求め、丸めの境界に近い時だけdd<double>で計算し直す
+					if constexpr (detail::use_rounding_type<U, Policy>) {
+						return T(detail::round_wide<floating_t, Policy>(spook::pow(U(fx), U(fy), spook::faithful), wider));
+					} else {
+						return T(floating_t(wider()));
+					}
+				} else {
+					constexpr int digits = detail::kernel_digits<floating_t, Policy>;
+
+					//y * log(x)の誤差はそのまま結果の相対誤差になるので、log(x)は2つの値で持つ
+					const auto [log_hi, log_lo] = detail::log_parts<floating_t, digits>(fx);
+					const auto [p, e] = detail::two_prod(fy, log_hi);
+
+					return T(detail::exp_sum<floating_t, digits>(p, e + fy * log_lo));
+				}
+			} else {
+				//その他の型に対しては未定義
+				static_assert([]{return false;}(), "spook::pow<T, N>() is not implemented.");
+			}
+		}
+
+		template<typename T, typename N>
+		SPOOK_CONSTEVAL auto pow(T x, N y) -> T {
+			return spook::pow(x, y, spook::faithful);
+		}
+
+		namespace detail {
+
+			/**
+			* @brief [0.5, 1)における1/sqrt(m)の初期値の係数（相対誤差 2^-11）
+			*/
+			template<typename T>
+			inline constexpr T rsqrt_guess[] = {
+				T(2.6049806078e+0L), T(-3.6383417968e+0L), T(2.9888494747e+0L), T(-9.5596593152e-1L)
+			};
+
+			/**
+			* @brief [0.5, 1)におけるcbrt(m)の初期値の係数（相対誤差 2^-13）
+			*/
+			template<typename T>
+			inline constexpr T cbrt_guess[] = {
+				T(4.3881448652e-1L), T(9.3183248729e-1L), T(-5.1719613042e-1L), T(1.4662195044e-1L)
+			};
+
+			/**
+			* @brief 初期値の精度initial_bitsから、2次収束の反復でDigits / 2 + 2ビットに達するまでの回数
+			* @detail 最後に残差で1回補正するので、反復自体は半分の精度で足りる
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto root_steps(int initial_bits) -> int {
+				int steps = 0;
+				for (int bits = initial_bits; bits < Digits / 2 + 2; bits = 2 * bits - 1) ++steps;
+				return steps;
+			}
+
+			/**
+			* @brief 正の有限値xを、x = (m * 2^r) * 2^(N * q)に分解する
+			* @return {mは[0.5, 1), rは[0, N), q}
+			*/
+			template<int N, typename T>
+			SPOOK_CONSTEVAL auto reduce_root(T x) -> std::tuple<T, int, int> {
+				int e = 0;
+				const T m = spook::frexp(x, &e);
+
+				//負の指数でも0 <= r < Nとなるように
+				const int r = ((e % N) + N) % N;
+
+				return { m, r, (e - r) / N };
+			}
+
+			/**
+			* @brief reduce_root<2>で分解した仮数について、1/sqrt(m * 2^r)をDigits / 2 + 2ビットまで求める
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			SPOOK_CONSTEVAL auto rsqrt_newton(T m, int r) -> T {
+				const T mr = (r == 0) ? m : m * T(2.0);
+
+				//初期値、ここだけは丸められても良い
+				T y = detail::polynomial(m, detail::rsqrt_guess<T>);
+				if (r != 0) y *= T(0.707106781186547524400844362104849039L);
+
+				constexpr int steps = detail::root_steps<T, Digits>(11);
+				for (int i = 0; i < steps; ++i) {
+					y += y * (T(0.5) - T(0.5) * mr * y * y);
+				}
+
+				return y;
+			}
+		}
+
+		/**
+		* @brief 正しく丸められた平方根
+		* @detail 指数を半分にし、[0.5, 2)に還元した仮数について1/sqrtのニュートン法を固定回数行ってから、残差で補正する
+		* @detail 最後に丸めの境界との大小を誤差なく調べるので、非正規化数の入力を含めて正しく丸められる
+		* @detail fast_tでは反復を減らし、丸めの境界を調べない。faithful_tとcorrectly_rounded_tは同じ
+		* @detail 実行時の組み込み型では、faithful_tとcorrectly_rounded_tは結果の等しいstd::sqrtを使う。
+		*         fast_tは定数式と結果を揃えるため、実行時も同じ反復で計算する
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto sqrt(T x, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if constexpr (std::is_floating_point_v<T> && !std::is_same_v<Policy, fast_t>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return std::sqrt(x);
+			}
+
+			if (x < T(0.0)) return limits::quiet_NaN();
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0) || spook::isinf(x) || spook::isnan(x)) return x;
+			}
+
+			const auto [m, r, q] = detail::reduce_root<2>(x);
+			const T mr = (r == 0) ? m : m * T(2.0);
+
+			if constexpr (std::is_same_v<Policy, fast_t>) {
+				const T y = detail::rsqrt_newton<T, detail::kernel_digits<T, Policy>>(m, r);
+				const T s = mr * y;
+
+				return spook::ldexp(s + (mr - s * s) * (T(0.5) * y), q);
+			}
+
+			const T y = detail::rsqrt_newton(m, r);
+
+			//s = sqrt(m)に対し、m - s^2を誤差なく求めて補正する
+			T s = mr * y;
+			{
+				const auto [p, e] = detail::two_prod(s, s);
+				s += ((mr - p) - e) * (T(0.5) * y);
+			}
+
+			//丸めの境界s ± ulp/2の2乗とmの大小を誤差なく比べて、最も近い値を選ぶ（sは[sqrt(2)/2, sqrt(2)]）
+			const T up = (s < T(1.0)) ? T(0.5) * limits::epsilon() : limits::epsilon();
+			const T down = (s <= T(1.0)) ? T(0.5) * limits::epsilon() : limits::epsilon();
+			const auto [p, pe] = detail::two_prod(s, s);
+			const auto [d, de] = detail::two_sum(p - mr, pe);
+
+			if ((d + s * up) + (de + T(0.25) * up * up) < T(0.0)) {
+				s += up;
+			} else if (T(0.0) < (d - s * down) + (de + T(0.25) * down * down)) {
+				s -= down;
+			}
+
+			return spook::ldexp(s, q);
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto sqrt(T x) -> T {
+			return spook::sqrt(x, spook::faithful);
+		}
+
+		/**
+		* @brief 精度の方針を指定した平方根の逆数
+		* @param Policy fast_t, faithful_t, correctly_rounded_tのいずれか
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto rsqrt(T x, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if (x < T(0.0)) return limits::quiet_NaN();
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0)) return limits::infinity();
+				if (spook::isinf(x)) return T(0.0);
+				if (spook::isnan(x)) return x;
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::rsqrt(U(x), spook::faithful), [x] { return spook::rsqrt(detail::evaluation_t<U, Policy>(U(x)), spook::faithful); });
+			}
+
+			const auto [m, r, q] = detail::reduce_root<2>(x);
+			const T mr = (r == 0) ? m : m * T(2.0);
+			T y = detail::rsqrt_newton<T, detail::kernel_digits<T, Policy>>(m, r);
+
+			//1 - m * y^2を誤差なく近い値で求めて補正する
+			const auto [p, pe] = detail::two_prod(y, y);
+			const auto [a, ae] = detail::two_prod(mr, p);
+			y += y * (T(0.5) * (((T(1.0) - a) - ae) - mr * pe));
+
+			return spook::ldexp(y, -q);
+		}
+
+		/**
+		* @brief 平方根の逆数
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto rsqrt(T x) -> T {
+			return spook::rsqrt(x, spook::faithful);
+		}
+
+		/**
+		* @brief 立方根
+		* @detail 指数を1/3にし、[0.5, 4)に還元した仮数についてニュートン法を固定回数行ってから、残差で補正する
+		*/
+		template<typename T, typename Policy, spook::enabler<spook::is_accuracy_policy<Policy>> = nullptr>
+		SPOOK_CONSTEVAL auto cbrt(T x, Policy) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			if (x < T(0.0)) return limits::quiet_NaN();
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0) || spook::isinf(x) || spook::isnan(x)) return x;
+			}
+
+			if constexpr (detail::use_rounding_type<T, Policy>) {
+				using U = detail::evaluation_t<T, Policy>;
+				return detail::round_wide<T, Policy>(spook::cbrt(U(x), spook::faithful), [x] { return spook::cbrt(detail::evaluation_t<U, Policy>(U(x)), spook::faithful); });
+			}
+
+			//2^(r/3)
+			constexpr T cbrt2[] = { T(1.0), T(1.25992104989487316476721060727822835L), T(1.58740105196819947475170563927230826L) };
+
+			const auto [m, r, q] = detail::reduce_root<3>(x);
+			const T mr = spook::ldexp(m, r);
+
+			T y = detail::polynomial(m, detail::cbrt_guess<T>) * cbrt2[r];
+
+			constexpr int steps = detail::root_steps<T, detail::kernel_digits<T, Policy>>(13);
+			for (int i = 0; i < steps; ++i) {
+				y -= (y - mr / (y * y)) / T(3.0);
+			}
+
+			//y^3 - mを誤差なく近い値で求めて補正する
+			const auto [a, ae] = detail::two_prod(y, y);
+			const auto [b, be] = detail::two_prod(a, y);
+			y -= ((b - mr) + (be + ae * y)) / (T(3.0) * a);
+
+			return spook::ldexp(y, q);
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto cbrt(T x) -> T {
+			return spook::cbrt(x, spook::faithful);
+		}
+
+		/**
+		* @brief N乗根
+		* @detail N = 2, 3はsqrtとcbrtを使う。それ以外は指数をNで割り、[0.5, 2^N)に還元した仮数についてlog2とexp2で初期値を求めてから、ニュートン法で仕上げる
+		*/
+		template<size_t N, typename T>
+		SPOOK_CONSTEVAL auto n_root(T x) -> T {
+			static_assert(0 < N, "spook::n_root<0>() is not defined.");
+
+			if constexpr (N == 1) {
+				return x;
+			} else if constexpr (N == 2) {
+				return spook::sqrt(x);
+			} else if constexpr (N == 3) {
+				return spook::cbrt(x);
+			} else {
+				using limits = spook::numeric_limits_traits<T>;
+
+				if (x < T(0.0)) return limits::quiet_NaN();
+				if (detail::has_special_values<T>) {
+					if (x == T(0.0) || spook::isinf(x) || spook::isnan(x)) return x;
+				}
+
+				const auto [m, r, q] = detail::reduce_root<int(N)>(x);
+				const T mr = spook::ldexp(m, r);
+
+				//log2(m * 2^r)は[-1, N)に収まるので、初期値の誤差は数ulp
+				T y = spook::exp2(spook::log2(mr) / T(N));
+
+				//y -= (y^N - m) / (N * y^(N - 1))
+				for (int i = 0; i < 2; ++i) {
+					const T y_n1 = spook::pow(y, N - 1);
+					y -= (y_n1 * y - mr) / (T(N) * y_n1);
+				}
+
+				return spook::ldexp(y, q);
+			}
+		}
+
+		namespace detail {
+
+			/**
+			* @brief sqrt(hi + lo)を、丸めの境界を調べずに上位と下位の2つの値で計算する
+			* @param hi 正規化数で、[2^(-max_exponent / 2), 2^(max_exponent / 2))であること
+			* @param lo |lo| <= ulp(hi)
+			* @return {上位, 下位, q}、sqrt(hi + lo) = (上位 + 下位) * 2^q
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto sqrt_parts(T hi, T lo) -> std::tuple<T, T, int> {
+				const auto [m, r, q] = detail::reduce_root<2>(hi);
+				const T mr = (r == 0) ? m : m * T(2.0);
+				const T y = detail::rsqrt_newton(m, r);
+
+				//(m + lo) - s^2で補正する
+				const T s = mr * y;
+				const auto [p, pe] = detail::two_prod(s, s);
+				const auto [s_hi, s_lo] = detail::fast_two_sum(s, (((mr - p) - pe) + lo * detail::pow2<T>(-2 * q)) * (T(0.5) * y));
+
+				return { s_hi, s_lo, q };
+			}
+
+			/**
+			* @brief 1/sqrt(hi + lo) * 2^-e
+			* @param hi 正規化数で、[2^(-max_exponent / 2), 2^(max_exponent / 2))であること
+			* @param lo |lo| <= ulp(hi)
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto rsqrt_sum(T hi, T lo, int e) -> T {
+				const auto [m, r, q] = detail::reduce_root<2>(hi);
+				const T mr = (r == 0) ? m : m * T(2.0);
+				T y = detail::rsqrt_newton(m, r);
+
+				//1 - (m + lo) * y^2で補正する
+				const auto [p, pe] = detail::two_prod(y, y);
+				const auto [a, ae] = detail::two_prod(mr, p);
+				y += y * (T(0.5) * ((((T(1.0) - a) - ae) - mr * pe) - lo * detail::pow2<T>(-2 * q) * p));
+
+				return spook::ldexp(y, -q - e);
+			}
+
+			/**
+			* @brief 要素の絶対値の最大値
+			* @return ∞があれば∞、そうでなくNaNがあればNaN
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto max_magnitude(const std::array<T, N>& v) -> T {
+				T amax = T(0.0);
+				bool nan = false;
+
+				for (const T x : v) {
+					if (spook::isinf(x)) return spook::numeric_limits_traits<T>::infinity();
+					if (spook::isnan(x)) {
+						nan = true;
+					} else if (amax < spook::fabs(x)) {
+						amax = spook::fabs(x);
+					}
+				}
+
+				return nan ? spook::numeric_limits_traits<T>::quiet_NaN() : amax;
+			}
+
+			/**
+			* @brief 各要素を2^-eでスケーリングしてから、2乗和を誤差なしの積と和で累積する
+			* @param e 最大の要素のilogb
+			* @return {上位, 下位}、2乗和 = (上位 + 下位) * 2^(2e)
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto scaled_sum_squares(const std::array<T, N>& v, int e) -> std::pair<T, T> {
+				//2^-eは正規化数の範囲を超えることがあるので2回に分けて掛ける、アンダーフローするのは2乗が無視できる要素だけ
+				const int half = -e / 2;
+				const T s1 = detail::pow2<T>(half);
+				const T s2 = detail::pow2<T>(-e - half);
+
+				T hi = T(0.0);
+				T lo = T(0.0);
+
+				for (const T x : v) {
+					const T a = (x * s1) * s2;
+					const auto [p, pe] = detail::two_prod(a, a);
+					const auto [s, se] = detail::two_sum(hi, p);
+
+					hi = s;
+					lo += se + pe;
+				}
+
+				return detail::fast_two_sum(hi, lo);
+			}
+		}
+
+		/**
+		* @brief ユークリッドノルム
+		* @detail 最大の要素の指数でスケーリングするので、途中でオーバーフローやアンダーフローしない
+		*/
+		template<typename T, std::size_t N>
+		SPOOK_CONSTEVAL auto norm(const std::array<T, N>& v) -> T {
+			const T amax = detail::max_magnitude(v);
+
+			if (!spook::isfinite(amax) || amax == T(0.0)) return amax;
+
+			const int e = spook::ilogb(amax);
+			const auto [hi, lo] = detail::scaled_sum_squares(v, e);
+			const auto [s_hi, s_lo, q] = detail::sqrt_parts(hi, lo);
+
+			return spook::ldexp(s_hi + s_lo, q + e);
+		}
+
+		/**
+		* @brief ユークリッドノルムの逆数
+		* @return 全ての要素が0の時は∞、∞を含む時は0
+		*/
+		template<typename T, std::size_t N>
+		SPOOK_CONSTEVAL auto rnorm(const std::array<T, N>& v) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+
+			const T amax = detail::max_magnitude(v);
+
+			if (spook::isnan(amax)) return amax;
+			if (spook::isinf(amax)) return T(0.0);
+			if (amax == T(0.0)) return limits::infinity();
+
+			const int e = spook::ilogb(amax);
+			const auto [hi, lo] = detail::scaled_sum_squares(v, e);
+
+			return detail::rsqrt_sum(hi, lo, e);
+		}
+
+		/**
+		* @brief sqrt(x^2 + y^2)
+		* @detail 片方が∞ならもう片方がNaNでも∞
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto hypot(T x, T y) -> T {
+			return spook::norm(std::array<T, 2>{ x, y });
+		}
+
+		/**
+		* @brief sqrt(x^2 + y^2 + z^2)
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto hypot(T x, T y, T z) -> T {
+			return spook::norm(std::array<T, 3>{ x, y, z });
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 双曲線関数で使用する閾値
+			*/
+			template<typename T>
+			struct hyperbolic_constants {
+				static constexpr int digits = spook::numeric_limits_traits<T>::digits;
+
+				//これより小さい|x|では、奇関数はx、coshは1に丸められる
+				static constexpr T tiny = detail::pow2<T>(-(digits + 1) / 2);
+				//これより大きい|x|では、exp(-|x|)がexp(|x|)の半ulpに満たない
+				static constexpr T large = T(digits + 2) * T(0.5) * exp_constants<T>::ln2;
+				//これより大きい|x|では、x^2 + 1 = x^2となる
+				static constexpr T huge = detail::pow2<T>(digits / 2 + 1);
+				//これより小さい|x|では、マクローリン級数を使う
+				static constexpr T series_bound = T(0.0625);
+			};
+
+			/**
+			* @brief |x| < 1/16における奇関数のマクローリン級数、f(x) = x + x^3 * (c[0] + c[1] * x^2 + ...)の係数
+			* @detail 項数は、打ち切った項(1/16)^(2n)が半ulpを下回るまで
+			*/
+			template<typename T>
+			struct odd_series {
+				static constexpr std::size_t terms = (spook::numeric_limits_traits<T>::digits + 1) / 8;
+
+				T sinh[terms]{};
+				T asinh[terms]{};
+				T atanh[terms]{};
+
+				constexpr odd_series() {
+					T factorial = T(1.0);
+					T ratio = T(1.0);
+
+					for (std::size_t i = 0; i < terms; ++i) {
+						const T n = T(i + 1);
+
+						//1 / (2n + 1)!
+						factorial *= (T(2.0) * n) * (T(2.0) * n + T(1.0));
+						sinh[i] = T(1.0) / factorial;
+						//(-1)^n * (2n - 1)!! / ((2n)!! * (2n + 1))
+						ratio *= -(T(2.0) * n - T(1.0)) / (T(2.0) * n);
+						asinh[i] = ratio / (T(2.0) * n + T(1.0));
+						//1 / (2n + 1)
+						atanh[i] = T(1.0) / (T(2.0) * n + T(1.0));
+					}
+				}
+			};
+
+			template<typename T>
+			inline constexpr odd_series<T> hyperbolic_series{};
+
+			/**
+			* @brief x + x^3 * (c[0] + c[1] * x^2 + ...)
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto odd_polynomial(T x, const T(&c)[N]) -> T {
+				const T z = x * x;
+				return x + x * (z * detail::polynomial(z, c));
+			}
+
+			/**
+			* @brief (n_hi + n_lo) / (d_hi + d_lo)を、残差で補正して2つの値で計算する
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto divide_parts(T n_hi, T n_lo, T d_hi, T d_lo) -> std::pair<T, T> {
+				const T q = n_hi / d_hi;
+				const auto [p, pe] = detail::two_prod(q, d_hi);
+
+				return { q, ((((n_hi - p) - pe) + n_lo) - q * d_lo) / d_hi };
+			}
+
+			/**
+			* @brief sqrt(hi + lo)を2つの値で計算する
+			* @param hi sqrt_partsの範囲であること
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto sqrt_sum(T hi, T lo) -> std::pair<T, T> {
+				const auto [s_hi, s_lo, q] = detail::sqrt_parts(hi, lo);
+				const T scale = detail::pow2<T>(q);
+
+				return { s_hi * scale, s_lo * scale };
+			}
+
+			/**
+			* @brief 大きなxについて、exp(x) / 2 = exp(x - log(2))
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto half_exp(T x) -> T {
+				using c = exp_constants<T>;
+
+				const auto [s, e] = detail::two_sum(x, -c::ln2);
+				return detail::exp_sum(s, e - c::ln2_tail);
+			}
+
+			/**
+			* @brief 大きなxについて、log(2x) = log(x) + log(2)
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto log_twice(T x) -> T {
+				using c = exp_constants<T>;
+
+				const auto [hi, lo] = detail::log_parts(x);
+				const auto [s, e] = detail::two_sum(hi, c::ln2);
+
+				return s + (e + (lo + c::ln2_tail));
+			}
+		}
+
+		/**
+		* @brief 双曲線正弦
+		* @detail |x| < 1/16ではマクローリン級数、それ以外はsinh(x) = (E + E / (E + 1)) / 2、E = expm1(|x|)
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto sinh(T x) -> T {
+			using c = detail::hyperbolic_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0) || spook::isinf(x) || spook::isnan(x)) return x;
+			}
+
+			const T a = spook::fabs(x);
+			T result{};
+
+			if (a < c::tiny) return x;
+			if (a < c::series_bound) return detail::odd_polynomial(x, detail::hyperbolic_series<T>.sinh);
+
+			if (c::large < a) {
+				result = detail::half_exp(a);
+			} else {
+				const auto [e_hi, e_lo] = detail::expm1_parts(a);
+				const auto [v, v_err] = detail::two_sum(T(1.0), e_hi);
+				const auto [q, q_lo] = detail::divide_parts(e_hi, e_lo, v, v_err + e_lo);
+				const auto [s, e] = detail::two_sum(e_hi, q);
+
+				result = T(0.5) * (s + (e + (e_lo + q_lo)));
+			}
+
+			return spook::signbit(x) ? -result : result;
+		}
+
+		/**
+		* @brief 双曲線余弦
+		* @detail cosh(x) = X / 2 + 1 / (2X)、X = exp(|x|)
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto cosh(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::hyperbolic_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x)) return x;
+				if (spook::isinf(x)) return limits::infinity();
+			}
+
+			const T a = spook::fabs(x);
+
+			if (a < c::tiny) return T(1.0);
+			if (c::large < a) return detail::half_exp(a);
+
+			const auto [e_hi, e_lo] = detail::expm1_parts(a);
+			const auto [v_hi, v_lo] = detail::two_sum(T(1.0), e_hi);
+			const T v = v_hi + (v_lo + e_lo);
+			const auto [s, e] = detail::fast_two_sum(T(0.5) * v_hi, T(0.5) / v);
+
+			return s + (e + T(0.5) * (v_lo + e_lo));
+		}
+
+		/**
+		* @brief 双曲線正接
+		* @detail tanh(x) = E / (E + 2)、E = expm1(2|x|)を1回だけ計算する
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto tanh(T x) -> T {
+			using c = detail::hyperbolic_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0) || spook::isnan(x)) return x;
+			}
+
+			const T a = spook::fabs(x);
+			T result{};
+
+			if (a < c::tiny) return x;
+
+			if (c::large < a) {
+				result = T(1.0);
+			} else {
+				const auto [e_hi, e_lo] = detail::expm1_parts(T(2.0) * a);
+				const auto [d, d_err] = detail::two_sum(T(2.0), e_hi);
+				const auto [q, q_lo] = detail::divide_parts(e_hi, e_lo, d, d_err + e_lo);
+
+				result = q + q_lo;
+			}
+
+			return spook::signbit(x) ? -result : result;
+		}
+
+		/**
+		* @brief 逆双曲線正弦
+		* @detail |x| < 1/16ではマクローリン級数、|x| <= 1ではasinh(x) = log1p(|x| + x^2 / (1 + sqrt(1 + x^2)))、それ以外はlog(|x| + sqrt(1 + x^2))
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto asinh(T x) -> T {
+			using c = detail::hyperbolic_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (x == T(0.0) || spook::isinf(x) || spook::isnan(x)) return x;
+			}
+
+			const T a = spook::fabs(x);
+			T result{};
+
+			if (a < c::tiny) return x;
+			if (a < c::series_bound) return detail::odd_polynomial(x, detail::hyperbolic_series<T>.asinh);
+
+			if (c::huge < a) {
+				result = detail::log_twice(a);
+			} else {
+				//sqrt(1 + x^2)を2つの値で持つ
+				const auto [p, pe] = detail::two_prod(a, a);
+				const auto [w, w_err] = detail::two_sum(T(1.0), p);
+				const auto [r_hi, r_lo] = detail::sqrt_sum(w, w_err + pe);
+
+				if (T(1.0) < a) {
+					//log(|x| + sqrt(1 + x^2))
+					const auto [u, u_err] = detail::two_sum(a, r_hi);
+					const auto [l_hi, l_lo] = detail::log_parts(u);
+
+					result = l_hi + (l_lo + (u_err + r_lo) / u);
+				} else {
+					const auto [t, t_lo] = detail::divide_parts(p, pe, T(1.0) + r_hi, r_lo);
+					const auto [u, u_err] = detail::fast_two_sum(a, t);
+
+					result = detail::log1p_sum(u, u_err + t_lo);
+				}
+			}
+
+			return spook::signbit(x) ? -result : result;
+		}
+
+		/**
+		* @brief 逆双曲線余弦
+		* @detail acosh(x) = log1p(t + sqrt(2t + t^2))、t = x - 1
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto acosh(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::hyperbolic_constants<T>;
+
+			if (spook::isnan(x) || x < T(1.0)) return limits::quiet_NaN();
+			if (x == T(1.0)) return T(0.0);
+			if (detail::has_special_values<T>) {
+				if (spook::isinf(x)) return x;
+			}
+
+			if (c::huge < x) return detail::log_twice(x);
+
+			//t = x - 1は丸められない
+			const T t = x - T(1.0);
+			const auto [p, pe] = detail::two_prod(t, t);
+			const auto [w, w_err] = detail::two_sum(T(2.0) * t, p);
+			const auto [r_hi, r_lo] = detail::sqrt_sum(w, w_err + pe);
+
+			const auto [u, u_err] = detail::two_sum(t, r_hi);
+			return detail::log1p_sum(u, u_err + r_lo);
+		}
+
+		/**
+		* @brief 逆双曲線正接
+		* @detail |x| < 1/16ではマクローリン級数、それ以外はatanh(x) = log1p(2|x| / (1 - |x|)) / 2
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto atanh(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::hyperbolic_constants<T>;
+
+			if (spook::isnan(x)) return x;
+
+			const T a = spook::fabs(x);
+
+			if (T(1.0) < a) return limits::quiet_NaN();
+			if (a == T(1.0)) return spook::signbit(x) ? -limits::infinity() : limits::infinity();
+			if (a < c::tiny) return x;
+			if (a < c::series_bound) return detail::odd_polynomial(x, detail::hyperbolic_series<T>.atanh);
+
+			const auto [d, d_err] = detail::two_sum(T(1.0), -a);
+			const auto [q, q_lo] = detail::divide_parts(T(2.0) * a, T(0.0), d, d_err);
+
+			const T result = T(0.5) * detail::log1p_sum(q, q_lo);
+
+			return spook::signbit(x) ? -result : result;
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 逆三角関数で使用する定数
+			*/
+			template<typename T>
+			struct atan_constants {
+				using limits = spook::numeric_limits_traits<T>;
+
+				static constexpr int digits = limits::digits;
+
+				static constexpr T pi_2 = detail::from_bits<T>(pi_over_2_bits, 0, digits, 0);
+				static constexpr T pi_2_tail = detail::from_bits<T>(pi_over_2_bits, digits, digits, 0);
+
+				//tan(pi/8) = sqrt(2) - 1、これより大きい比はatan(x) = pi/4 + atan((x - 1) / (x + 1))で還元する
+				static constexpr T tan_pi_8 = T(0.414213562373095048801688724209698078570L);
+				//これより小さい|x|では、atan(x) = x
+				static constexpr T tiny = detail::pow2<T>(-(digits + 1) / 2);
+				//この範囲の値はDekkerの方法で分割してもオーバー/アンダーフローしない
+				static constexpr T safe_min = detail::pow2<T>(limits::min_exponent / 2);
+				static constexpr T safe_max = detail::pow2<T>(limits::max_exponent / 2);
+			};
+
+			/**
+			* @brief [-tan(pi/8), tan(pi/8)]におけるatanの最良近似多項式の係数
+			* @detail atan(x) = x + x^3 * (P1 + P2 * x^2 + ...)
+			* @detail 仮数部の桁数毎に用意し、無い場合はマクローリン級数で計算する
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			struct atan_minimax {
+				static constexpr bool available = false;
+			};
+
+			//float、誤差 2^-30
+			template<typename T>
+			struct atan_minimax<T, 24> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(-3.3333315189e-01L), T(1.9998471516e-01L), T(-1.4243533359e-01L), T(1.0593813828e-01L), T(-6.0782216403e-02L)
+				};
+			};
+
+			//double、誤差 2^-59
+			template<typename T>
+			struct atan_minimax<T, 53> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(-3.333333333333319617e-01L), T(1.999999999995324775e-01L), T(-1.428571428016659485e-01L), T(1.111111078215653368e-01L),
+					T(-9.090897725292880878e-02L), T(7.692059718124551900e-02L), T(-6.663099211316668010e-02L), T(5.847859326122230259e-02L),
+					T(-5.039190655749669869e-02L), T(3.806214555747493426e-02L), T(-1.790504553018668180e-02L)
+				};
+			};
+
+			//x87拡張倍精度、誤差 2^-73
+			template<typename T>
+			struct atan_minimax<T, 64> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(-3.33333333333333333227e-01L), T(1.99999999999999943588e-01L), T(-1.42857142857132315941e-01L),
+					T(1.11111111110114395129e-01L), T(-9.09090908531305329856e-02L), T(7.69230748855604637479e-02L),
+					T(-6.66666159259001406887e-02L), T(5.88226364356754890134e-02L), T(-5.26202650536394408983e-02L),
+					T(4.75150902967345509583e-02L), T(-4.27876946311841438884e-02L), T(3.67312056970960777308e-02L),
+					T(-2.63156408455971438599e-02L), T(1.11450439147561138376e-02L)
+				};
+			};
+
+			//4倍精度、誤差 2^-121
+			template<typename T>
+			struct atan_minimax<T, 113> {
+				static constexpr bool available = true;
+
+				static constexpr T p[] = {
+					T(-3.333333333333333333333333333333331684e-01L), T(1.999999999999999999999999999997557984e-01L),
+					T(-1.428571428571428571428571415793691144e-01L), T(1.111111111111111111111107680281957712e-01L),
+					T(-9.090909090909090909085326540388679803e-02L), T(7.692307692307692307086747593614295534e-02L),
+					T(-6.666666666666666620097188670196695789e-02L), T(5.882352941176467938804769600175627604e-02L),
+					T(-5.263157894736727117189241770321842380e-02L), T(4.761904761900867200223623374993622736e-02L),
+					T(-4.347826086851808635283064529747972546e-02L), T(3.999999997736762519429938853041370916e-02L),
+					T(-3.703703664016123705230985635810592793e-02L), T(3.448275293869973642425006874311650159e-02L),
+					T(-3.225799785610397762438782308991496009e-02L), T(3.030238867783554425595631780302775199e-02L),
+					T(-2.856636788479266672634679515774717578e-02L), T(2.699444553344680824564660461650928621e-02L),
+					T(-2.547096214842537870550155879121399359e-02L), T(2.367789026130287721906652543593434390e-02L),
+					T(-2.089492737021349325221344832906359535e-02L), T(1.614397855386987989733373187311596625e-02L),
+					T(-9.373007409781979243822025115843881901e-03L), T(2.941554437131710131092584963152602373e-03L)
+				};
+			};
+
+			/**
+			* @brief [-tan(pi/8), tan(pi/8)]におけるatan(hi + lo)
+			* @return {上位, 下位}、足し合わせる前の2つの値
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto atan_kernel(T hi, T lo) -> std::pair<T, T> {
+				using coeff = atan_minimax<T>;
+
+				const T z = hi * hi;
+				T r{};
+
+				if constexpr (coeff::available) {
+					r = hi * (z * detail::polynomial(z, coeff::p));
+				} else {
+					//マクローリン級数、x^2 <= 3 - 2sqrt(2)なので項数はdigits / 2.5程度
+					const auto& c = kernel_series_v<T, spook::numeric_limits_traits<T>::digits>;
+					r = hi * (z * detail::split_polynomial(z, c.atan, 0, c.atan_terms.second));
+				}
+
+				//atan(hi + lo) = atan(hi) + lo / (1 + hi^2)
+				return { hi, r + lo / (T(1.0) + z) };
+			}
+
+			/**
+			* @brief 比がtan(pi/8)以下の時のatan((n + n_lo) / (d + d_lo))
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto atan_ratio_direct(T n, T n_lo, T d, T d_lo) -> std::pair<T, T> {
+				const auto [t, t_lo] = detail::divide_parts(n, n_lo, d, d_lo);
+				return detail::atan_kernel(t, t_lo);
+			}
+
+			/**
+			* @brief 比がtan(pi/8)より大きい時のatan((n + n_lo) / (d + d_lo))
+			* @detail atan(n / d) = pi/4 + atan((n - d) / (n + d))
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto atan_ratio_shifted(T n, T n_lo, T d, T d_lo) -> std::pair<T, T> {
+				using c = atan_constants<T>;
+
+				const auto [u, u_err] = detail::two_sum(n, -d);
+				const auto [v, v_err] = detail::two_sum(n, d);
+				const auto [t, t_lo] = detail::divide_parts(u, u_err + (n_lo - d_lo), v, v_err + (n_lo + d_lo));
+				const auto [k_hi, k_lo] = detail::atan_kernel(t, t_lo);
+				const auto [s, e] = detail::fast_two_sum(T(0.5) * c::pi_2, k_hi);
+
+				return { s, e + (T(0.5) * c::pi_2_tail + k_lo) };
+			}
+
+			/**
+			* @brief atan((n + n_lo) / (d + d_lo))
+			* @param n 0 <= n <= dであること
+			* @param d 正の有限値
+			* @return {上位, 下位}、[0, pi/4]
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto atan_ratio(T n, T n_lo, T d, T d_lo) -> std::pair<T, T> {
+				using c = atan_constants<T>;
+
+				const T q = n / d;
+				if (q < c::tiny) return { q, (n_lo - q * d_lo) / d };
+
+				//極端な大きさの時は、dを[1, 2)に揃えてから計算する
+				if (d < c::safe_min || c::safe_max < d) {
+					const int e = spook::ilogb(d);
+
+					n = spook::ldexp(n, -e);
+					n_lo = spook::ldexp(n_lo, -e);
+					d = spook::ldexp(d, -e);
+					d_lo = spook::ldexp(d_lo, -e);
+				}
+
+				if (q <= c::tan_pi_8) return detail::atan_ratio_direct(n, n_lo, d, d_lo);
+
+				return detail::atan_ratio_shifted(n, n_lo, d, d_lo);
+			}
+
+			/**
+			* @brief pi/2 - (hi + lo)
+			* @param angle [0, pi/2]の角度の上位と下位
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto half_pi_minus(const std::pair<T, T>& angle) -> std::pair<T, T> {
+				using c = atan_constants<T>;
+
+				const auto [s, e] = detail::fast_two_sum(c::pi_2, -angle.first);
+				return { s, e + (c::pi_2_tail - angle.second) };
+			}
+
+			/**
+			* @brief 第1象限の点(x + x_lo, y + y_lo)の偏角
+			* @param y, x 0以上の有限値で、どちらかは0でないこと
+			* @return {上位, 下位}、[0, pi/2]
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto atan2_kernel(T y, T y_lo, T x, T x_lo) -> std::pair<T, T> {
+				if (y <= x) return detail::atan_ratio(y, y_lo, x, x_lo);
+
+				//atan(y / x) = pi/2 - atan(x / y)
+				return detail::half_pi_minus(detail::atan_ratio(x, x_lo, y, y_lo));
+			}
+
+			/**
+			* @brief pi - (hi + lo)
+			* @param angle [0, pi/2]の角度の上位と下位
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto pi_minus(const std::pair<T, T>& angle) -> std::pair<T, T> {
+				using c = atan_constants<T>;
+
+				const auto [s, e] = detail::fast_two_sum(T(2.0) * c::pi_2, -angle.first);
+				return { s, e + (T(2.0) * c::pi_2_tail - angle.second) };
+			}
+
+			/**
+			* @brief sqrt(1 - x^2)を2つの値で計算する
+			* @param x [0, 1)
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto sqrt_one_minus_square(T x) -> std::pair<T, T> {
+				const auto [p, pe] = detail::two_prod(x, x);
+				const auto [w, w_err] = detail::two_sum(T(1.0), -p);
+				const auto [w_hi, w_lo] = detail::fast_two_sum(w, w_err - pe);
+
+				return detail::sqrt_sum(w_hi, w_lo);
+			}
+		}
+
+		/**
+		* @brief 逆正接
+		* @detail |x| > 1ではatan(x) = pi/2 - atan(1/x)、|x| > tan(pi/8)ではpi/4 + atan((x - 1) / (x + 1))として、[-tan(pi/8), tan(pi/8)]の多項式に還元する
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto atan(T arg) -> T {
+			using c = detail::atan_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::iszero(arg) || spook::isnan(arg)) return arg;
+				if (spook::isinf(arg)) return spook::copysign(c::pi_2, arg);
+			}
+
+			const T x = spook::fabs(arg);
+			if (x < c::tiny) return arg;
+
+			const auto [hi, lo] = detail::atan2_kernel(x, T(0.0), T(1.0), T(0.0));
+			const T result = hi + lo;
+
+			return spook::signbit(arg) ? -result : result;
+		}
+
+		/**
+		* @brief 点(x, y)の偏角
+		* @detail |y|と|x|の小さい方を大きい方で割って、atanの還元に乗せる
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto atan2(T y, T x) -> T {
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(y) || spook::isnan(x)) return spook::numeric_limits_traits<T>::quiet_NaN();
+
+				if (spook::iszero(y)) {
+					if (spook::signbit(x)) {
+						return spook::copysign(spook::constant::pi<T>, y);
+					}
+					else {
+						return spook::copysign(T(0.0), y);
+					}
+				}
+
+				if (spook::iszero(x)) {
+					return spook::copysign(spook::constant::pi<T> / T(2.0), y);
+				}
+
+				if (spook::isinf(y)) {
+					if (spook::isinf(x)) {
+						if (spook::signbit(x)) {
+							return spook::copysign(T(3.0) * spook::constant::pi<T> / T(4.0), y);
+						}
+						else {
+							return spook::copysign(spook::constant::pi<T> / T(4.0), y);
+						}
+					}
+
+					return spook::copysign(spook::constant::pi<T> / T(2.0), y);
+				}
+				else {
+					if (spook::isinf(x)) {
+						if (spook::signbit(x)) {
+							return spook::copysign(spook::constant::pi<T>, y);
+						}
+						else {
+							return spook::copysign(T(0.0), y);
+						}
+					}
+				}
+			}
+
+			auto angle = detail::atan2_kernel(spook::fabs(y), T(0.0), spook::fabs(x), T(0.0));
+			if (spook::signbit(x)) angle = detail::pi_minus(angle);
+
+			const T result = angle.first + angle.second;
+
+			return spook::signbit(y) ? -result : result;
+		}
+
+		/**
+		* @brief 逆正弦
+		* @detail asin(x) = atan2(x, sqrt(1 - x^2))、sqrt(1 - x^2)は2つの値で持つ
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto asin(T arg) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::atan_constants<T>;
+
+			if (spook::isnan(arg)) return arg;
+
+			const T x = spook::fabs(arg);
+
+			if (T(1.0) < x) return limits::quiet_NaN();
+			if (x < c::tiny) return arg;
+
+			T result = c::pi_2;
+			if (x < T(1.0)) {
+				const auto [r_hi, r_lo] = detail::sqrt_one_minus_square(x);
+				const auto [hi, lo] = detail::atan2_kernel(x, T(0.0), r_hi, r_lo);
+
+				result = hi + lo;
+			}
+
+			return spook::signbit(arg) ? -result : result;
+		}
+
+		/**
+		* @brief 逆余弦
+		* @detail acos(x) = atan2(sqrt(1 - x^2), x)、sqrt(1 - x^2)は2つの値で持つ
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto acos(T arg) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::atan_constants<T>;
+
+			if (spook::isnan(arg)) return arg;
+
+			const T x = spook::fabs(arg);
+
+			if (T(1.0) < x) return limits::quiet_NaN();
+			//acos(x) = pi/2 - x
+			if (x < c::tiny) return (c::pi_2 - arg) + c::pi_2_tail;
+			if (x == T(1.0)) return spook::signbit(arg) ? T(2.0) * c::pi_2 : T(0.0);
+
+			const auto [r_hi, r_lo] = detail::sqrt_one_minus_square(x);
+			auto angle = detail::atan2_kernel(r_hi, r_lo, x, T(0.0));
+			if (spook::signbit(arg)) angle = detail::pi_minus(angle);
+
+			return angle.first + angle.second;
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 2/sqrt(pi)の2進展開（32bit毎、先頭の最上位ビットが2^0の位）
+			*/
+			inline constexpr std::uint32_t two_over_sqrt_pi_bits[] = {
+				0x906EBA82, 0x14DB688D, 0x71D48A7F, 0x6BFEC344, 0x1409A0EB, 0xAC3E7517, 0x39A15830, 0xCCE620B0,
+				0xC0759CF8, 0x59270F11, 0x40C03609, 0x6CC79AEB,
+			};
+
+			/**
+			* @brief 誤差関数で使用する定数
+			*/
+			template<typename T>
+			struct erf_constants {
+				using limits = spook::numeric_limits_traits<T>;
+
+				static constexpr int digits = limits::digits;
+
+				static constexpr T two_over_sqrt_pi = detail::from_bits<T>(two_over_sqrt_pi_bits, 0, digits, 0);
+				static constexpr T two_over_sqrt_pi_tail = detail::from_bits<T>(two_over_sqrt_pi_bits, digits, digits, 0);
+
+				//これより小さい|x|では、erf(x) = 2x / sqrt(pi)
+				static constexpr T tiny = detail::pow2<T>(-(digits + 3) / 2);
+				//x^2がこれ以上なら、erfc(x) < exp(-x^2)が1の半ulpに満たない
+				static constexpr T saturation = T(digits + 1) * exp_constants<T>::ln2;
+				//x^2がこれ以上なら、erfc(x)は非正規化数の最小値の半分に満たない
+				static constexpr T underflow = T(digits - limits::min_exponent + 1) * exp_constants<T>::ln2;
+			};
+
+			/**
+			* @brief 誤差関数の最良近似多項式の係数
+			* @detail [0, 1]       erf(x) = 2x / sqrt(pi) + x^3 * (E1 + E2 * x^2 + ...)
+			* @detail [1/2, 2]     exp(x^2) * erfc(x) = S0 + S1 * (x - 5/4) + ...
+			* @detail [2, 4]       exp(x^2) * erfc(x) = M0 + M1 * (x - 3) + ...
+			* @detail [4, ∞)      x * exp(x^2) * erfc(x) = L0 + L1 / x^2 + ...
+			* @detail 仮数部の桁数毎に用意し、無い場合は級数と連分数で計算する
+			*/
+			template<typename T, int Digits = spook::numeric_limits_traits<T>::digits>
+			struct erf_minimax {
+				static constexpr bool available = false;
+			};
+
+			//float、相対誤差 erf:2^-29, small:2^-28, medium:2^-28, large:2^-29
+			template<typename T>
+			struct erf_minimax<T, 24> {
+				static constexpr bool available = true;
+
+				static constexpr T erf[] = {
+					T(-3.7612629820e-1L), T(1.1283617367e-1L), T(-2.6854916062e-2L), T(5.1901624882e-3L), T(-8.0248186350e-4L),
+					T(7.8986948949e-5L)
+				};
+
+				static constexpr T small[] = {
+					T(3.6782291661e-1L), T(-2.0882188745e-1L), T(1.0679556092e-1L), T(-5.0217859454e-2L), T(2.2011439133e-2L),
+					T(-9.0857857678e-3L), T(3.5533758597e-3L), T(-1.3089455268e-3L), T(4.7084770168e-4L), T(-1.9225320531e-4L),
+					T(6.1634020015e-5L)
+				};
+
+				static constexpr T medium[] = {
+					T(1.7900115181e-1L), T(-5.4372259711e-2L), T(1.5884339422e-2L), T(-4.4794296756e-3L), T(1.2232928635e-3L),
+					T(-3.2416219908e-4L), T(8.2849352426e-5L), T(-2.0856827844e-5L), T(5.9328243730e-6L), T(-1.4007200670e-6L)
+				};
+
+				static constexpr T large[] = {
+					T(5.6418958268e-1L), T(-2.8209373787e-1L), T(4.2293432598e-1L), T(-1.0425749939e+0L), T(3.1721088991e+0L),
+					T(-7.1819551688e+0L)
+				};
+			};
+
+			//double、相対誤差 erf:2^-62, small:2^-57, medium:2^-60, large:2^-58
+			template<typename T>
+			struct erf_minimax<T, 53> {
+				static constexpr bool available = true;
+
+				static constexpr T erf[] = {
+					T(-3.761263890318374922e-1L), T(1.128379167095490807e-1L), T(-2.686617064508014900e-2L), T(5.223977624838849362e-3L),
+					T(-8.548326981601466118e-4L), T(1.205533112893113934e-4L), T(-1.492559549720185934e-5L), T(1.646100196643591413e-6L),
+					T(-1.635031045463620854e-7L), T(1.465966581600912999e-8L), T(-1.137213656801141995e-9L), T(5.955578729052520271e-11L)
+				};
+
+				static constexpr T small[] = {
+					T(3.678229164523610917e-1L), T(-2.088218759646098492e-1L), T(1.067955714965992448e-1L), T(-5.021827439590682420e-2L),
+					T(2.201136425083022198e-2L), T(-9.081627632954746500e-3L), T(3.553109903848309978e-3L), T(-1.325782929452758755e-3L),
+					T(4.739703030869193472e-4L), T(-1.629600104927783000e-4L), T(5.405410765912723830e-5L), T(-1.734407739885751314e-5L),
+					T(5.395466367458497869e-6L), T(-1.630681775393782374e-6L), T(4.800963553529332734e-7L), T(-1.375501108629712114e-7L),
+					T(3.774695694122404196e-8L), T(-1.039158188634931887e-8L), T(3.400645200584705637e-9L), T(-8.639154102404688502e-10L)
+				};
+
+				static constexpr T medium[] = {
+					T(1.790011511813899503e-1L), T(-5.437226000717287162e-2L), T(1.588437115987136065e-2L), T(-4.479431018372564108e-3L),
+					T(1.223039052375998341e-3L), T(-3.241255444969830783e-4L), T(8.355413963909278292e-5L), T(-2.098946445997703802e-5L),
+					T(5.146436494713223232e-6L), T(-1.233367724126379059e-6L), T(2.892669268849657635e-7L), T(-6.646687871837197964e-8L),
+					T(1.497711713809892708e-8L), T(-3.312819528198586863e-9L), T(7.206514376080485618e-10L), T(-1.538950224950744223e-10L),
+					T(3.165271289576799076e-11L), T(-6.573689296469541125e-12L), T(1.664277878413078347e-12L), T(-3.286963655603733607e-13L)
+				};
+
+				static constexpr T large[] = {
+					T(5.641895835477562860e-1L), T(-2.820947917738707199e-1L), T(4.231421876515779462e-1L), T(-1.057855464602641527e+0L),
+					T(3.702492964125139690e+0L), T(-1.666103883416852401e+1L), T(9.161763176863387793e+1L), T(-5.942670702377495911e+2L),
+					T(4.396264606509741338e+3L), T(-3.524817562685834098e+4L), T(2.816004395895440868e+5L), T(-2.002345352966873394e+6L),
+					T(1.112485019619930636e+7L), T(-4.096869311116364943e+7L), T(7.289517487923806906e+7L)
+				};
+			};
+
+			/**
+			* @brief 最良近似多項式が無い型で使う、誤差関数の級数の係数
+			* @detail erf(x) = 2x / sqrt(pi) + x^3 * (erf[0] + erf[1] * x^2 + ...)、|x| <= 1のマクローリン級数
+			* @detail exp(x^2) * erfc(x) = scaled[0] - scaled[1] * x + scaled[2] * x^2 - ...、|x| <= 2のマクローリン級数
+			* @detail x > 2では連分数をfraction_depth段で打ち切る
+			*/
+			template<typename T>
+			struct erf_series {
+				static constexpr int digits = spook::numeric_limits_traits<T>::digits;
+
+				//打ち切った項1 / (n! * (2n + 1))が2^-(digits + 2)を下回るまで
+				static constexpr std::size_t erf_terms = [] {
+					const T bound = detail::pow2<T>(-(digits + 2));
+					T factorial = T(1.0);
+					std::size_t n = 1;
+
+					for (; ; ++n) {
+						factorial *= T(n);
+						if (T(1.0) / (factorial * T(2 * n + 1)) < bound) break;
+					}
+
+					return n - 1;
+				}();
+
+				//打ち切った項2^n / Γ(n/2 + 1)が2^-(digits + 8)を下回るまで（x = 2付近では6bit程度桁落ちする）
+				static constexpr std::size_t scaled_terms = [] {
+					const T bound = detail::pow2<T>(-(digits + 8));
+					T even = T(1.0);
+					T odd = erf_constants<T>::two_over_sqrt_pi;
+					std::size_t n = 1;
+
+					for (; ; ++n) {
+						//1 / Γ(n/2 + 1) = 1 / Γ((n - 2)/2 + 1) / (n/2)
+						T& d = (n % 2 == 0) ? even : odd;
+						if (1 < n) d /= T(0.5) * T(n);
+						if (detail::pow2<T>(int(n)) * d < bound) break;
+					}
+
+					return n;
+				}();
+
+				//x = 2で打ち切り誤差がおおよそ2^-(digits + 5)となる段数
+				static constexpr int fraction_depth = (digits + 5) * (digits + 5) / 50 + 10;
+
+				T erf[erf_terms]{};
+				T scaled[scaled_terms]{};
+
+				constexpr erf_series() {
+					T factorial = T(1.0);
+
+					for (std::size_t i = 0; i < erf_terms; ++i) {
+						const T n = T(i + 1);
+
+						//2 / sqrt(pi) * (-1)^n / (n! * (2n + 1))
+						factorial *= -n;
+						erf[i] = erf_constants<T>::two_over_sqrt_pi / (factorial * (T(2.0) * n + T(1.0)));
+					}
+
+					scaled[0] = T(1.0);
+					scaled[1] = erf_constants<T>::two_over_sqrt_pi;
+					for (std::size_t i = 2; i < scaled_terms; ++i) {
+						scaled[i] = scaled[i - 2] / (T(0.5) * T(i));
+					}
+				}
+			};
+
+			template<typename T>
+			inline constexpr erf_series<T> erf_series_v{};
+
+			/**
+			* @brief [0, 1]におけるerf(x)
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto erf_kernel(T x) -> std::pair<T, T> {
+				using c = erf_constants<T>;
+				using coeff = erf_minimax<T>;
+
+				const auto& terms = [] () -> const auto& {
+					if constexpr (coeff::available) {
+						return coeff::erf;
+					} else {
+						return erf_series_v<T>.erf;
+					}
+				}();
+
+				//x^3の項はerf(x)の1/4程度になるので、x^3も2つに分けて持つ
+				const auto [z, ze] = detail::two_prod(x, x);
+				const auto [x3, x3e] = detail::two_prod(x, z);
+				const auto [t, te] = detail::two_prod(x3, terms[0]);
+				const T r = x3 * (z * detail::polynomial(z, terms, 1));
+
+				//2x / sqrt(pi)は2つに分けて持つ
+				const auto [p, pe] = detail::two_prod(x, c::two_over_sqrt_pi);
+				const auto [hi, lo] = detail::two_sum(p, t);
+
+				return detail::fast_two_sum(hi, lo + ((pe + te) + (x * c::two_over_sqrt_pi_tail + (x3e + x * ze) * terms[0] + r)));
+			}
+
+			/**
+			* @brief x >= 1/2におけるexp(x^2) * erfc(x)
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto erfc_scaled(T x) -> std::pair<T, T> {
+				using coeff = erf_minimax<T>;
+
+				if constexpr (coeff::available) {
+					//最後の1項だけ丸め誤差を拾う、x - 1.25とx - 3は誤差なく求まる
+					const auto leading = [](T d, const auto& c) {
+						const auto [p, pe] = detail::two_prod(d, detail::polynomial(d, c, 1));
+						const auto [s, e] = detail::two_sum(c[0], p);
+						return detail::fast_two_sum(s, e + pe);
+					};
+
+					if (x < T(2.0)) return leading(x - T(1.25), coeff::small);
+					if (x < T(4.0)) return leading(x - T(3.0), coeff::medium);
+
+					//1/x * P(1/x^2)、P(1/x^2)はほぼ定数項なので、最後の和と除算の丸め誤差を拾う
+					const T u = T(1.0) / x;
+					const T w = u * u;
+					const auto [s, e] = detail::fast_two_sum(coeff::large[0], w * detail::polynomial(w, coeff::large, 1));
+
+					return detail::divide_parts(s, e, x, T(0.0));
+				} else {
+					using series = erf_series<T>;
+
+					if (x < T(2.0)) return { detail::polynomial(-x, erf_series_v<T>.scaled), T(0.0) };
+
+					//exp(x^2) * erfc(x) = 1 / sqrt(pi) / (x + (1/2) / (x + 1 / (x + (3/2) / (x + ...))))
+					T f = x;
+					for (int k = series::fraction_depth; 0 < k; --k) {
+						f = x + (T(0.5) * T(k)) / f;
+					}
+
+					return { (T(0.5) * erf_constants<T>::two_over_sqrt_pi) / f, T(0.0) };
+				}
+			}
+
+			/**
+			* @brief x >= 1/2におけるerfc(x) = exp(-x^2) * (exp(x^2) * erfc(x))
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto erfc_tail(T x) -> T {
+				//x^2は2つに分けて持ち、expの引数の丸め誤差を拾う
+				const auto [s, e] = detail::two_prod(x, x);
+
+				//exp(-x^2) = 2^k * (1 + m)、g * (1 + m)を1度だけ丸めてから2^kを掛ける
+				const auto r = detail::reduce_ln2(-s);
+				const auto [r_hi, r_lo] = detail::fast_two_sum(r.hi, r.lo - e);
+				const auto [m_hi, m_lo] = detail::expm1_kernel(r_hi, r_lo);
+				const auto [g_hi, g_lo] = detail::erfc_scaled(x);
+
+				return spook::ldexp(g_hi + (g_lo + g_hi * (m_hi + m_lo)), r.k);
+			}
+		}
+
+		/**
+		* @brief 誤差関数
+		* @detail |x| < 1では多項式、それ以外はerf(x) = 1 - erfc(x)
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto erf(T x) -> T {
+			using c = detail::erf_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::iszero(x) || spook::isnan(x)) return x;
+				if (spook::isinf(x)) return spook::copysign(T(1.0), x);
+			}
+
+			const T a = spook::fabs(x);
+
+			//正規化数の最小値付近でx * 下位がアンダーフローしないように、2^digits倍して計算する
+			if (a < c::tiny) {
+				using limits = spook::numeric_limits_traits<T>;
+				const T scaled = x * detail::pow2<T>(limits::digits);
+				const auto [p, pe] = detail::two_prod(scaled, c::two_over_sqrt_pi);
+				return (p + (pe + scaled * c::two_over_sqrt_pi_tail)) * detail::pow2<T>(-limits::digits);
+			}
+
+			T result = T(1.0);
+			if (a < T(1.0)) {
+				const auto [hi, lo] = detail::erf_kernel(a);
+				result = hi + lo;
+			} else if (a * a < c::saturation) {
+				result = T(1.0) - detail::erfc_tail(a);
+			}
+
+			return spook::signbit(x) ? -result : result;
+		}
+
+		/**
+		* @brief 相補誤差関数
+		* @detail |x| < 1/2ではerfc(x) = 1 - erf(x)、それ以外はerfc(x) = exp(-x^2) * (exp(x^2) * erfc(x))
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto erfc(T x) -> T {
+			using c = detail::erf_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x)) return x;
+				if (spook::isinf(x)) return spook::signbit(x) ? T(2.0) : T(0.0);
+			}
+
+			const T a = spook::fabs(x);
+
+			if (a < c::tiny) return T(1.0) - x * c::two_over_sqrt_pi;
+
+			if (a < T(0.5)) {
+				const auto [hi, lo] = detail::erf_kernel(a);
+				const bool negative = spook::signbit(x);
+
+				//|erf(x)| < 1なので、1 - erf(x)の丸め誤差は拾える
+				const auto [s, e] = detail::fast_two_sum(T(1.0), negative ? hi : -hi);
+				return s + (negative ? e + lo : e - lo);
+			}
+
+			//erfc(-x) = 2 - erfc(x)
+			const T tail = (a * a < c::underflow) ? detail::erfc_tail(a) : T(0.0);
+			return spook::signbit(x) ? T(2.0) - tail : tail;
+		}
+
+		namespace detail {
+
+			/**
+			* @brief log(2pi)/2の2進展開（32bit毎、先頭の最上位ビットが小数第1位）
+			*/
+			inline constexpr std::uint32_t half_log_2pi_bits[] = {
+				0xEB3F8E43, 0x25F5A534, 0x94BC9001, 0x44192023, 0xCFB08F8D, 0x13458B4D, 0xDEC6A313, 0x3DAA155D,
+				0x212F9D7F, 0xE00E86BF, 0x93EABF90, 0x5C5569BB,
+			};
+
+			/**
+			* @brief オイラーの定数γの2進展開（32bit毎、先頭の最上位ビットが小数第1位）
+			*/
+			inline constexpr std::uint32_t euler_gamma_bits[] = {
+				0x93C467E3, 0x7DB0C7A4, 0xD1BE3F81, 0x0152CB56, 0xA1CECC3A, 0xF65CC019, 0x0C03DF34, 0x709AFFBD,
+			};
+
+			/**
+			* @brief 1 - γの2進展開（32bit毎、先頭の最上位ビットが小数第1位、その値は0）
+			*/
+			inline constexpr std::uint32_t one_minus_euler_gamma_bits[] = {
+				0x6C3B981C, 0x824F385B, 0x2E41C07E, 0xFEAD34A9, 0x5E3133C5, 0x09A33FE6, 0xF3FC20CB, 0x8F650042,
+			};
+
+			/**
+			* @brief スターリングの級数の係数B_2k / (2k * (2k - 1))の分子と分母
+			*/
+			inline constexpr std::int64_t stirling_fractions[][2] = {
+				{ 1, 12 }, { -1, 360 }, { 1, 1260 }, { -1, 1680 }, { 1, 1188 }, { -691, 360360 }, { 1, 156 }, { -3617, 122400 },
+				{ 43867, 244188 }, { -174611, 125400 }, { 77683, 5796 }, { -236364091, 1506960 }, { 657931, 300 },
+				{ -3392780147, 93960 }, { 1723168255201, 2492028 },
+			};
+
+			/**
+			* @brief ガンマ関数で使用する定数
+			*/
+			template<typename T>
+			struct gamma_constants {
+				using limits = spook::numeric_limits_traits<T>;
+
+				static constexpr int digits = limits::digits;
+
+				static constexpr T half_log_2pi = detail::from_bits<T>(half_log_2pi_bits, 0, digits, -1);
+				static constexpr T half_log_2pi_tail = detail::from_bits<T>(half_log_2pi_bits, digits, digits, -1);
+
+				//オイラーの定数γと1 - γ
+				static constexpr T euler_gamma = detail::from_bits<T>(euler_gamma_bits, 0, digits, -1);
+				static constexpr T euler_gamma_tail = detail::from_bits<T>(euler_gamma_bits, digits, digits, -1);
+				static constexpr T one_minus_euler_gamma = detail::from_bits<T>(one_minus_euler_gamma_bits, 1, digits, -1);
+				static constexpr T one_minus_euler_gamma_tail = detail::from_bits<T>(one_minus_euler_gamma_bits, digits + 1, digits, -1);
+
+				//これより小さいxでは、Γ(x) = 1 / x
+				static constexpr T tiny = detail::pow2<T>(-(digits + 1));
+				//これ以上のxでは、スターリングの級数を使う
+				static constexpr T stirling_bound = T((digits + 3) / 4);
+				//これより小さいxでは、Γ(x)を積で求める
+				static constexpr T product_bound = T(4 * digits);
+				//これ以上のxでは、log(Γ(x)) = x * (log(x) - 1)
+				static constexpr T huge = detail::pow2<T>(digits + 1);
+				//これ以上の|x|は整数
+				static constexpr T integral_bound = detail::pow2<T>(digits - 1);
+			};
+
+			/**
+			* @brief スターリングの級数と、log(Γ(1 + x))、log(Γ(2 + x))のテイラー級数の係数
+			* @detail log(Γ(x)) = (x - 1/2) * log(x) - x + log(2pi)/2 + stirling[0] / x + stirling[1] / x^3 + ...
+			* @detail log(Γ(1 + x)) = -γx + near_one[0] * x^2 + near_one[1] * x^3 + ...、|x| <= 1/4
+			* @detail log(Γ(2 + x)) = (1 - γ)x + near_two[0] * x^2 + near_two[1] * x^3 + ...、|x| <= 1/2
+			*/
+			template<typename T>
+			struct gamma_series {
+				static constexpr int digits = spook::numeric_limits_traits<T>::digits;
+				static constexpr std::size_t stirling_max = std::size(stirling_fractions);
+
+				//stirling_boundで、打ち切った項が2^-(digits + 2)を下回るまで
+				static constexpr std::size_t stirling_terms = [] {
+					const T x = gamma_constants<T>::stirling_bound;
+					const T bound = detail::pow2<T>(-(digits + 2));
+					T power = x;
+
+					for (std::size_t k = 1; k < stirling_max; ++k) {
+						power *= x * x;
+
+						const T next = T(stirling_fractions[k][0]) / T(stirling_fractions[k][1]);
+						if (spook::fabs(next) < bound * power) return k;
+					}
+
+					return stirling_max;
+				}();
+
+				//打ち切った項(1/4)^kが2^-(digits + 2)を下回るまで
+				static constexpr std::size_t zeta_terms = std::size_t(digits / 2 + 1);
+
+				T stirling[stirling_terms]{};
+				T near_one[zeta_terms]{};
+				T near_two[zeta_terms]{};
+
+				constexpr gamma_series() {
+					for (std::size_t i = 0; i < stirling_terms; ++i) {
+						stirling[i] = T(stirling_fractions[i][0]) / T(stirling_fractions[i][1]);
+					}
+
+					//ζ(k) - 1をオイラー・マクローリンの公式で求める、n^-kはn < Nまで直接足す
+					constexpr int N = 32;
+					T power[N + 1]{};
+					for (int n = 2; n <= N; ++n) power[n] = T(1.0) / T(n);
+
+					for (std::size_t i = 0; i < zeta_terms; ++i) {
+						const int k = int(i) + 2;
+						for (int n = 2; n <= N; ++n) power[n] /= T(n);
+
+						//N^(1-k) / (k - 1) + N^-k / 2 + Σ B_2j / (2j)! * k(k + 1)...(k + 2j - 2) * N^(-k-2j+1)
+						T tail = T(0.0);
+						T factor = T(k) * power[N] / T(N);
+						for (std::size_t j = 1; j <= stirling_max; ++j) {
+							const T b = T(stirling_fractions[j - 1][0]) / T(stirling_fractions[j - 1][1]);
+							tail += b * factor;
+
+							const T m = T(2 * j);
+							factor *= (T(k) + m - T(1.0)) * (T(k) + m) / ((m - T(1.0)) * m * T(N) * T(N));
+						}
+						tail += power[N] * T(N) / T(k - 1) + T(0.5) * power[N];
+
+						T zeta = tail;
+						for (int n = N - 1; 2 <= n; --n) zeta += power[n];
+
+						//(-1)^k * ζ(k) / k、(-1)^k * (ζ(k) - 1) / k
+						const T sign = (k % 2 == 0) ? T(1.0) : T(-1.0);
+						near_one[i] = sign * (T(1.0) + zeta) / T(k);
+						near_two[i] = sign * zeta / T(k);
+					}
+				}
+			};
+
+			template<typename T>
+			inline constexpr gamma_series<T> gamma_series_v{};
+
+			/**
+			* @brief c1 * x + c[0] * x^2 + c[1] * x^3 + ...
+			* @detail 1次と2次の項は打ち消し合うことがあるので、その2つは丸め誤差を拾う
+			* @return {上位, 下位}
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto lgamma_series(T x, T c1, T c1_tail, const T(&c)[N]) -> std::pair<T, T> {
+				const auto [z, ze] = detail::two_prod(x, x);
+				const auto [p, pe] = detail::two_prod(x, c1);
+				const auto [t, te] = detail::two_prod(z, c[0]);
+				const auto [s, e] = detail::two_sum(p, t);
+
+				const T rest = (x * z) * detail::polynomial(x, c, 1);
+
+				return detail::fast_two_sum(s, e + ((pe + te) + (x * c1_tail + ze * c[0] + rest)));
+			}
+
+			/**
+			* @brief |x| <= 1/4におけるlog(Γ(1 + x))
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto lgamma_near_one(T x) -> std::pair<T, T> {
+				using c = gamma_constants<T>;
+				return detail::lgamma_series(x, -c::euler_gamma, -c::euler_gamma_tail, gamma_series_v<T>.near_one);
+			}
+
+			/**
+			* @brief |x| <= 1/2におけるlog(Γ(2 + x))
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto lgamma_near_two(T x) -> std::pair<T, T> {
+				using c = gamma_constants<T>;
+				return detail::lgamma_series(x, c::one_minus_euler_gamma, c::one_minus_euler_gamma_tail, gamma_series_v<T>.near_two);
+			}
+
+			/**
+			* @brief スターリングの級数で、log(Γ(x))を2つの値で計算する
+			* @param x [stirling_bound, huge)
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto lgamma_stirling(T x) -> std::pair<T, T> {
+				using c = gamma_constants<T>;
+
+				const auto [l, l_lo] = detail::log_parts(x);
+
+				//(x - 1/2) * log(x)
+				const auto [w, w_err] = detail::two_sum(x, T(-0.5));
+				const auto [p, pe] = detail::two_prod(w, l);
+				const T p_lo = pe + (w * l_lo + w_err * l);
+
+				//- x + log(2pi)/2
+				const auto [s, se] = detail::two_sum(p, -x);
+				const auto [t, te] = detail::two_sum(s, c::half_log_2pi);
+
+				const T u = T(1.0) / x;
+				const T series = u * detail::polynomial(u * u, gamma_series_v<T>.stirling);
+
+				return detail::fast_two_sum(t, te + ((se + p_lo) + (c::half_log_2pi_tail + series)));
+			}
+
+			/**
+			* @brief x > 0におけるlog(Γ(x))を2つの値で計算する
+			* @detail stirling_boundより小さいxは、漸化式で零点1, 2の近傍のテイラー級数に帰着させる
+			* @param x (0, huge)
+			* @return {上位, 下位}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto lgamma_parts(T x) -> std::pair<T, T> {
+				using c = gamma_constants<T>;
+
+				if (x < c::tiny) {
+					const auto [hi, lo] = detail::log_parts(x);
+					return { -hi, -lo };
+				}
+
+				if (T(0.75) <= x && x <= T(1.25)) return detail::lgamma_near_one(x - T(1.0));
+				if (T(1.5) <= x && x <= T(2.5)) return detail::lgamma_near_two(x - T(2.0));
+				if (c::stirling_bound <= x) return detail::lgamma_stirling(x);
+
+				//log(Γ(x)) = g ± log(p)、pは2つに分けて持つ
+				std::pair<T, T> g{};
+				T p = x;
+				T p_lo = T(0.0);
+				bool down = false;
+
+				if (x < T(0.25)) {
+					//log(Γ(1 + x)) - log(x)
+					g = detail::lgamma_near_one(x);
+				} else if (x <= T(0.5)) {
+					//log(Γ(2 + x)) - log(x * (x + 1))
+					g = detail::lgamma_near_two(x);
+
+					const auto [s, se] = detail::two_sum(x, T(1.0));
+					const auto [m, me] = detail::two_prod(x, s);
+					const auto [q, q_lo] = detail::fast_two_sum(m, me + x * se);
+					p = q;
+					p_lo = q_lo;
+				} else if (x < T(1.5)) {
+					//log(Γ(2 + (x - 1))) - log(x)、x - 1は丸められない
+					g = detail::lgamma_near_two(x - T(1.0));
+				} else {
+					//log(Γ(y)) + log((x - 1) * (x - 2) * ... * y)、yは(1.5, 2.5]で、x - nは丸められない
+					T y = x;
+					p = T(1.0);
+
+					while (T(2.5) < y) {
+						y -= T(1.0);
+
+						const auto [m, me] = detail::two_prod(p, y);
+						const auto [q, q_lo] = detail::fast_two_sum(m, me + p_lo * y);
+						p = q;
+						p_lo = q_lo;
+					}
+
+					g = detail::lgamma_near_two(y - T(2.0));
+					down = true;
+				}
+
+				const auto [l, l_err] = detail::log_parts(p);
+				const T l_lo = l_err + p_lo / p;
+				const auto [s, e] = detail::two_sum(g.first, down ? l : -l);
+
+				return detail::fast_two_sum(s, e + (down ? g.second + l_lo : g.second - l_lo));
+			}
+
+			/**
+			* @brief [2, product_bound)におけるΓ(x)を2つの値で計算する
+			* @detail Γ(x) = (x - 1) * (x - 2) * ... * y * Γ(y)、yは[2, 3)で、積は2つに分けて持つ
+			* @return {上位, 下位, k}、Γ(x) = (上位 + 下位) * 2^k
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto tgamma_parts(T x) -> std::tuple<T, T, int> {
+				constexpr int digits = spook::numeric_limits_traits<T>::digits;
+
+				T y = x;
+				T p = T(1.0);
+				T p_lo = T(0.0);
+				int k = 0;
+
+				//x - nは丸められない
+				while (T(3.0) <= y) {
+					y -= T(1.0);
+
+					const auto [m, me] = detail::two_prod(p, y);
+					const auto [q, q_lo] = detail::fast_two_sum(m, me + p_lo * y);
+					p = q;
+					p_lo = q_lo;
+
+					//two_prodの分割がオーバーフローしないように、積を小さく保つ
+					if (detail::pow2<T>(digits) <= p) {
+						p *= detail::pow2<T>(-digits);
+						p_lo *= detail::pow2<T>(-digits);
+						k += digits;
+					}
+				}
+
+				//Γ(y) = 1 + expm1(log(Γ(y)))、log(Γ(y))は[0, log(2))
+				const auto [l, l_lo] = detail::lgamma_parts(y);
+				const auto [e, e_lo] = detail::expm1_parts(l);
+				const auto [g, g_err] = detail::fast_two_sum(T(1.0), e);
+				const T g_lo = g_err + (e_lo + l_lo * (T(1.0) + e));
+
+				const auto [r, re] = detail::two_prod(p, g);
+				const auto [hi, lo] = detail::fast_two_sum(r, re + (p * g_lo + p_lo * g));
+
+				return { hi, lo, k };
+			}
+
+			/**
+			* @brief 非整数yについて、相反公式Γ(-y) = -pi / (y * sin(pi * y) * Γ(y))の分母の一部
+			* @param y [tiny, integral_bound)の非整数
+			* @return {y * |sin(pi * y)|の上位, 下位, Γ(-y)が負ならtrue}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto reflection_denominator(T y) -> std::tuple<T, T, bool> {
+				using c = gamma_constants<T>;
+				using a = atan_constants<T>;
+
+				//yに最も近い整数nと、r = y - n（[-1/2, 1/2]で丸められない）
+				const T n = (y + c::integral_bound) - c::integral_bound;
+				const T r = y - n;
+				const T half = T(0.5) * n;
+				const bool odd = ((half + c::integral_bound) - c::integral_bound) != half;
+
+				//|sin(pi * r)|、pi * |r|は2つに分けて持つ
+				const T t = spook::fabs(r);
+				const T v = (T(0.25) < t) ? T(0.5) - t : t;
+				const auto [x_hi, x_err] = detail::two_prod(v, T(2.0) * a::pi_2);
+				const auto [x, x_lo] = detail::fast_two_sum(x_hi, x_err + v * (T(2.0) * a::pi_2_tail));
+				const auto [s, s_lo] = (T(0.25) < t) ? detail::cos_kernel_parts(x, x_lo) : detail::sin_kernel_parts(x, x_lo);
+				const auto [d, d_err] = detail::two_prod(y, s);
+
+				//sin(pi * y) = (-1)^n * sin(pi * r)
+				return { d, d_err + y * s_lo, odd != (T(0.0) < r) };
+			}
+
+			/**
+			* @brief 負の非整数xについて、Γ(x) = -pi / (y * sin(pi * y) * Γ(y))、y = -xとなる
+			* @param y [tiny, integral_bound)の非整数
+			* @return {log|Γ(-y)|の上位, 下位, Γ(-y)が負ならtrue}
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto lgamma_reflection(T y) -> std::tuple<T, T, bool> {
+				using a = atan_constants<T>;
+
+				//log(pi / (y * |sin(pi * y)|)) - log(Γ(y))
+				const auto [d, d_lo, negative] = detail::reflection_denominator(y);
+				const auto [q, q_lo] = detail::divide_parts(T(2.0) * a::pi_2, T(2.0) * a::pi_2_tail, d, d_lo);
+				const auto [lq, lq_lo] = detail::log_parts(q);
+				const auto [l, l_lo] = detail::lgamma_parts(y);
+				const auto [hi, lo] = detail::two_sum(lq, -l);
+
+				return { hi, lo + ((lq_lo + q_lo / q) - l_lo), negative };
+			}
+		}
+
+		/**
+		* @brief ガンマ関数の絶対値の自然対数
+		* @detail x >= (digits + 3) / 4ではスターリングの級数、それより小さいxは漸化式で零点1, 2の近傍のテイラー級数に帰着させる
+		* @detail 負のxは相反公式、(-8, -2)にある零点の近傍では相対誤差ではなく絶対誤差がulp程度になる
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto lgamma(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::gamma_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x)) return x;
+				if (spook::isinf(x)) return limits::infinity();
+			}
+
+			const T a = spook::fabs(x);
+
+			//極
+			if (a == T(0.0) || (x < T(0.0) && (c::integral_bound <= a || a == (a + c::integral_bound) - c::integral_bound))) {
+				return limits::infinity();
+			}
+
+			//a * (log(a) - 1)、two_prodの分割がオーバーフローしないように2^-digits倍して掛ける
+			if (c::huge <= a) {
+				const T b = a * detail::pow2<T>(-limits::digits);
+				const auto [l, l_lo] = detail::log_parts(a);
+				const auto [s, e] = detail::two_sum(l, T(-1.0));
+				const auto [p, pe] = detail::two_prod(b, s);
+
+				return (p + (pe + b * (e + l_lo))) * detail::pow2<T>(limits::digits);
+			}
+
+			if (x < T(0.0) && c::tiny <= a) {
+				const auto [hi, lo, negative] = detail::lgamma_reflection(a);
+				return hi + lo;
+			}
+
+			const auto [hi, lo] = detail::lgamma_parts(a);
+			return hi + lo;
+		}
+
+		/**
+		* @brief ガンマ関数
+		* @detail [2, 4 * digits)では[2, 3)からの積、それ以外はΓ(x) = exp(log(Γ(x)))で、どちらも2つの値で持つ
+		* @detail 負のxは相反公式
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto tgamma(T x) -> T {
+			using limits = spook::numeric_limits_traits<T>;
+			using c = detail::gamma_constants<T>;
+
+			if (detail::has_special_values<T>) {
+				if (spook::isnan(x)) return x;
+				if (spook::isinf(x)) return spook::signbit(x) ? limits::quiet_NaN() : x;
+				//Γ(±0) = ±∞
+				if (spook::iszero(x)) return detail::sign_bit(x) ? -limits::infinity() : limits::infinity();
+			}
+
+			const T a = spook::fabs(x);
+
+			if (x < T(0.0)) {
+				//負の整数は極
+				if (c::integral_bound <= a || a == (a + c::integral_bound) - c::integral_bound) return limits::quiet_NaN();
+
+				if (a < c::tiny) return T(1.0) / x;
+
+				//pi / (y * |sin(pi * y)| * Γ(y))
+				if (T(2.0) <= a && a < c::product_bound) {
+					using pi = detail::atan_constants<T>;
+
+					const auto [d, d_lo, negative] = detail::reflection_denominator(a);
+					const auto [g, g_lo, k] = detail::tgamma_parts(a);
+					const auto [m, me] = detail::two_prod(d, g);
+					const auto [q, q_lo] = detail::divide_parts(T(2.0) * pi::pi_2, T(2.0) * pi::pi_2_tail, m, me + (d * g_lo + d_lo * g));
+					const T result = spook::ldexp(q + q_lo, -k);
+
+					return negative ? -result : result;
+				}
+
+				const auto [hi, lo, negative] = detail::lgamma_reflection(a);
+				const T result = detail::exp_sum(hi, lo);
+
+				return negative ? -result : result;
+			}
+
+			//Γ(x) > 2^max_exponent
+			if (T(limits::max_exponent) < x) return limits::infinity();
+
+			if (T(2.0) <= x && x < c::product_bound) {
+				const auto [hi, lo, k] = detail::tgamma_parts(x);
+				return spook::ldexp(hi + lo, k);
+			}
+
+			const auto [hi, lo] = detail::lgamma_parts(x);
+			return detail::exp_sum(hi, lo);
+		}
+
+		template<typename T>
+		SPOOK_CONSTEVAL auto lerp(T a, T b, T t) -> T {
+			if (spook::iszero(t)) return a;
+			if (t == T(1.0)) return b;
+			if (spook::isfinite(t) && a == b) return a;
+
+			return a + t * (b - a);
+		}
+	}
+
+	inline namespace double_double {
+
+		/**
+		* @brief 2つの浮動小数点数の和hi + loで値を表す倍々精度型
+		* @detail |lo| <= ulp(hi) / 2に正規化して持ち、仮数部はTの2倍の桁数、指数部の範囲はTと同じ
+		* @tparam T 構成要素の浮動小数点数型
+		*/
+		template<typename T>
+		struct dd {
+			T hi{};
+			T lo{};
+
+			constexpr dd() = default;
+
+			/**
+			* @brief 算術型からの変換、Tで表せない部分は下位に持つ
+			*/
+			template<typename U, enabler<std::is_arithmetic<U>> = nullptr>
+			constexpr dd(U x) : hi(T(x)), lo(T(0.0)) {
+				if constexpr (std::is_integral_v<U>) {
+					if constexpr (std::numeric_limits<T>::digits < std::numeric_limits<U>::digits) {
+						//上位からTの桁数ずつ切り出せば、それぞれはTで丸められずに表せる
+						constexpr int digits = std::numeric_limits<T>::digits;
+						dd r = from_parts(T(0.0), T(0.0));
+						U rest = x;
+
+						for (int shift = std::numeric_limits<U>::digits - digits; 0 < shift; shift -= digits) {
+							const U low = rest % (U(1) << shift);
+							r = r + dd(T(rest - low), T(0.0));
+							rest = low;
+						}
+						*this = r + dd(T(rest), T(0.0));
+					}
+				} else if constexpr (std::numeric_limits<T>::digits < std::numeric_limits<U>::digits) {
+					if (spook::isfinite(hi)) lo = T(x - U(hi));
+				}
+			}
+
+			/**
+			* @brief hi + loを正規化して持つ
+			*/
+			constexpr dd(T h, T l) : hi(h + l), lo(T(0.0)) {
+				if (spook::isfinite(hi)) {
+					const auto [s, e] = cmath::detail::two_sum(h, l);
+					hi = s;
+					lo = e;
+				}
+			}
+
+			/**
+			* @brief 正規化済みの2つの値からそのまま作る
+			*/
+			static constexpr auto from_parts(T h, T l) -> dd {
+				dd r{};
+				r.hi = h;
+				r.lo = l;
+				return r;
+			}
+
+			/**
+			* @brief 算術型への変換、整数型へは0方向へ丸める
+			*/
+			template<typename U, enabler<std::is_arithmetic<U>> = nullptr>
+			explicit constexpr operator U() const {
+				if constexpr (std::is_integral_v<U>) {
+					const U n = U(hi);
+					const T rest = (hi - T(n)) + lo;
+					U m = U(rest);
+
+					//restが整数でなく、hiと符号が逆なら、和を0方向へ丸めた分だけずれる
+					if (T(m) != rest) {
+						if (T(0.0) < hi && rest < T(0.0)) m -= U(1);
+						if (hi < T(0.0) && T(0.0) < rest) m += U(1);
+					}
+					return n + m;
+				} else {
+					return U(hi) + U(lo);
+				}
+			}
+
+			friend constexpr auto operator+(const dd& a) -> dd {
+				return a;
+			}
+
+			friend constexpr auto operator-(const dd& a) -> dd {
+				return from_parts(-a.hi, -a.lo);
+			}
+
+			friend constexpr auto operator+(const dd& a, const dd& b) -> dd {
+				const auto [s, e] = cmath::detail::two_sum(a.hi, b.hi);
+				if (!spook::isfinite(s)) return from_parts(s, T(0.0));
+
+				//下位同士の和の丸め誤差も拾う
+				const auto [t, f] = cmath::detail::two_sum(a.lo, b.lo);
+				const auto [u, g] = cmath::detail::fast_two_sum(s, e + t);
+				const auto [hi, lo] = cmath::detail::fast_two_sum(u, g + f);
+
+				return from_parts(hi, lo);
+			}
+
+			friend constexpr auto operator-(const dd& a, const dd& b) -> dd {
+				return a + (-b);
+			}
+
+			friend constexpr auto operator*(const dd& a, const dd& b) -> dd {
+				using limits = std::numeric_limits<T>;
+
+				const T p = a.hi * b.hi;
+				if (!spook::isfinite(p)) return from_parts(p, T(0.0));
+
+				//分割がオーバーフローする大きさなら、大きい方を2^-digits倍してから掛けて戻す（定数式ではオーバーフロー自体が許されない）
+				constexpr T split_bound = cmath::detail::scale2(T(1.0), limits::max_exponent - (limits::digits + 1) / 2 - 2);
+				T e{};
+
+				if (spook::fabs(a.hi) < split_bound && spook::fabs(b.hi) < split_bound) {
+					e = cmath::detail::two_prod(a.hi, b.hi).second;
+				} else {
+					constexpr int s = limits::digits;
+					const bool a_larger = spook::fabs(b.hi) < spook::fabs(a.hi);
+					const T x = a_larger ? cmath::detail::scale2(a.hi, -s) : a.hi;
+					const T y = a_larger ? b.hi : cmath::detail::scale2(b.hi, -s);
+					e = cmath::detail::scale2(cmath::detail::two_prod(x, y).second, s);
+				}
+
+				const auto [hi, lo] = cmath::detail::fast_two_sum(p, e + (a.hi * b.lo + a.lo * b.hi));
+				return from_parts(hi, lo);
+			}
+
+			friend constexpr auto operator/(const dd& a, const dd& b) -> dd {
+				const T q1 = a.hi / b.hi;
+				if (!spook::isfinite(q1) || q1 == T(0.0)) return from_parts(q1, T(0.0));
+
+				//商を3回に分けて求め、残差を誤差なく引いていく
+				dd r = a - b * dd(q1);
+				const T q2 = r.hi / b.hi;
+				r = r - b * dd(q2);
+				const T q3 = r.hi / b.hi;
+
+				return dd(q1, q2) + dd(q3);
+			}
+
+			constexpr auto operator+=(const dd& b) -> dd& { return *this = *this + b; }
+			constexpr auto operator-=(const dd& b) -> dd& { return *this = *this - b; }
+			constexpr auto operator*=(const dd& b) -> dd& { return *this = *this * b; }
+			constexpr auto operator/=(const dd& b) -> dd& { return *this = *this / b; }
+
+			constexpr auto operator++() -> dd& { return *this += dd(T(1.0)); }
+			constexpr auto operator--() -> dd& { return *this -= dd(T(1.0)); }
+
+			friend constexpr auto operator==(const dd& a, const dd& b) -> bool {
+				return a.hi == b.hi && a.lo == b.lo;
+			}
+
+			friend constexpr auto operator!=(const dd& a, const dd& b) -> bool {
+				return !(a == b);
+			}
+
+			friend constexpr auto operator<(const dd& a, const dd& b) -> bool {
+				return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+			}
+
+			friend constexpr auto operator>(const dd& a, const dd& b) -> bool {
+				return b < a;
+			}
+
+			friend constexpr auto operator<=(const dd& a, const dd& b) -> bool {
+				return a.hi < b.hi || (a.hi == b.hi && a.lo <= b.lo);
+			}
+
+			friend constexpr auto operator>=(const dd& a, const dd& b) -> bool {
+				return b <= a;
+			}
+		};
+
+		/**
+		* @brief 倍々精度の平方根
+		* @detail Tの平方根を、残差で1度補正する
+		*/
+		template<typename T>
+		SPOOK_CONSTEVAL auto sqrt(dd<T> x) -> dd<T> {
+			if (x.hi < T(0.0)) return dd<T>(std::numeric_limits<T>::quiet_NaN());
+			if (x.hi == T(0.0) || !spook::isfinite(x.hi)) return dd<T>::from_parts(x.hi, T(0.0));
+
+			const T s = spook::sqrt(x.hi);
+			const dd<T> r = x - dd<T>(s) * dd<T>(s);
+
+			return dd<T>(s, r.hi / (T(2.0) * s));
+		}
+	}
+
+	inline namespace customization_points {
+
+		/**
+		* @brief 倍々精度型のnumeric_limits
+		* @detail 指数部の範囲はTと同じで、最小の正規化数は下位も正規化数となる値
+		*/
+		template<typename T>
+		struct numeric_limits_traits<double_double::dd<T>> {
+		private:
+			using base = spook::numeric_limits_traits<T>;
+			using type = double_double::dd<T>;
+
+		public:
+			static constexpr bool is_specialized = true;
+			static constexpr bool is_signed = true;
+			static constexpr bool is_integer = false;
+			static constexpr bool is_exact = false;
+			static constexpr bool has_infinity = base::has_infinity;
+			static constexpr bool has_quiet_NaN = base::has_quiet_NaN;
+			static constexpr bool has_signaling_NaN = base::has_signaling_NaN;
+			static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+			static constexpr bool has_denorm_loss = false;
+			static constexpr std::float_round_style round_style = std::round_to_nearest;
+			static constexpr bool is_iec559 = false;
+			static constexpr bool is_bounded = true;
+			static constexpr bool is_modulo = false;
+			static constexpr int digits = 2 * base::digits;
+			static constexpr int digits10 = (digits - 1) * 30103 / 100000;
+			static constexpr int max_digits10 = digits * 30103 / 100000 + 2;
+			static constexpr int radix = 2;
+			static constexpr int min_exponent = base::min_exponent + base::digits;
+			static constexpr int min_exponent10 = base::min_exponent10 + base::digits10;
+			static constexpr int max_exponent = base::max_exponent;
+			static constexpr int max_exponent10 = base::max_exponent10;
+			static constexpr bool traps = false;
+			static constexpr bool tinyness_before = false;
+
+			static constexpr auto min() noexcept -> type {
+				return type(cmath::detail::scale2((base::min)(), base::digits));
+			}
+
+			static constexpr auto max() noexcept -> type {
+				//下位は上位の1ulpの半分より僅かに小さい
+				const T hi = (base::max)();
+				return type::from_parts(hi, cmath::detail::scale2(hi, -(base::digits + 1)) * (T(1.0) - base::epsilon()));
+			}
+
+			static constexpr auto lowest() noexcept -> type {
+				return -(max)();
+			}
+
+			static constexpr auto epsilon() noexcept -> type {
+				return type(cmath::detail::scale2(T(1.0), 1 - digits));
+			}
+
+			static constexpr auto round_error() noexcept -> type {
+				return type(T(0.5));
+			}
+
+			static constexpr auto infinity() noexcept -> type {
+				return type::from_parts(base::infinity(), T(0.0));
+			}
+
+			static constexpr auto quiet_NaN() noexcept -> type {
+				return type::from_parts(base::quiet_NaN(), T(0.0));
+			}
+
+			static constexpr auto signaling_NaN() noexcept -> type {
+				return type::from_parts(base::signaling_NaN(), T(0.0));
+			}
+
+			static constexpr auto denorm_min() noexcept -> type {
+				return (min)();
+			}
+		};
+
+		template<typename T>
+		struct is_floating_point<double_double::dd<T>> : std::true_type {};
+	}
+
+	inline namespace complex {
+
+		template<typename T CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto polar(T rho, T theta) -> std::complex<T> {
+			const auto [sin_v, cos_v] = spook::sincos(theta);
+
+			return{ rho * cos_v, rho * sin_v };
+		}
+	}
+
+	inline namespace table {
+
+		namespace detail {
+
+			/**
+			* @brief 直接計算する基準点の間隔の上限
+			* @detail 表のi番目はi - i % sync_interval番目の基準点からの加法定理で求めるので、誤差は蓄積しない
+			*/
+			inline constexpr std::size_t resync_interval = 256;
+
+			/**
+			* @brief N点の表で基準点を置く間隔
+			* @detail 基準点とずれの値をどちらも直接計算するので、合わせて2sqrt(N)点程度になるようにsqrt(N)以上の2の冪とする（resync_interval以下）
+			*/
+			template<std::size_t N>
+			inline constexpr std::size_t sync_interval = [] {
+				std::size_t r = 1;
+				while (r < resync_interval && r * r < N) r *= 2;
+				return r;
+			}();
+
+			/**
+			* @brief 基準点等の値を直接計算する型、floatはdouble、それ以外はT
+			*/
+			template<typename T>
+			using direct_t = std::conditional_t<std::is_same_v<T, float>, double, T>;
+
+			/**
+			* @brief [lo, hi]をn点で標本化する刻み幅
+			*/
+			template<typename T>
+			SPOOK_CONSTEVAL auto table_step(T lo, T hi, std::size_t n) -> T {
+				if (n < 2) return T(0.0);
+
+				return (hi - lo) / T(n - 1);
+			}
+
+			/**
+			* @brief 標本点ごとにfを呼んで表を作る
+			*/
+			template<std::size_t N, typename T, typename F>
+			SPOOK_CONSTEVAL auto sample_table(F f, T lo, T hi) -> std::array<T, N> {
+				const T step = detail::table_step(lo, hi, N);
+				std::array<T, N> table{};
+
+				for (std::size_t i = 0; i < N; ++i) {
+					table[i] = T(f(lo + step * T(i)));
+				}
+
+				return table;
+			}
+
+			/**
+			* @brief 標本点lo + i * stepを丸めずに上位と下位の2つの値で求める
+			* @return {上位, 下位}
+			*/
+			template<typename D>
+			SPOOK_CONSTEVAL auto exact_point(D lo, D step, std::size_t i) -> std::pair<D, D> {
+				const auto [p, p_err] = cmath::detail::two_prod(step, D(i));
+				const auto [s, s_err] = cmath::detail::two_sum(lo, p);
+
+				return cmath::detail::two_sum(s, s_err + p_err);
+			}
+
+			/**
+			* @brief 上位と下位の2つの値で表した値の符号を反転する
+			*/
+			template<typename D>
+			SPOOK_CONSTEVAL auto negate_parts(const std::pair<D, D>& x) -> std::pair<D, D> {
+				return { -x.first, -x.second };
+			}
+
+			/**
+			* @brief 表の値を組み立てる積の因数、上位と下位の2つの値と、誤差なしの積のために上位を半分の桁に分割した値
+			* @detail 同じ因数を何度も掛けるので、two_prodの分割を前もって済ませておく
+			*/
+			template<typename D>
+			struct product_operand {
+				D hi;
+				D lo;
+				D head;
+				D tail;
+			};
+
+			template<typename D>
+			SPOOK_CONSTEVAL auto make_operand(const std::pair<D, D>& x) -> product_operand<D> {
+				constexpr int half = (spook::numeric_limits_traits<D>::digits + 1) / 2;
+				constexpr D splitter = cmath::detail::scale2(D(1.0), half) + D(1.0);
+
+				const D c = splitter * x.first;
+				const D head = c - (c - x.first);
+
+				return { x.first, x.second, head, x.first - head };
+			}
+
+			/**
+			* @brief 因数の積の上位と、上位同士の積の丸め誤差と交差項を合わせた下位
+			* @return {上位, 下位}、下位同士の積は無視する
+			*/
+			template<typename D>
+			SPOOK_CONSTEVAL auto multiply_operands(const product_operand<D>& a, const product_operand<D>& b) -> std::pair<D, D> {
+				const D p = a.hi * b.hi;
+				const D p_err = ((a.head * b.head - p) + a.head * b.tail + a.tail * b.head) + a.tail * b.tail;
+
+				return { p, p_err + (a.hi * b.lo + a.lo * b.hi) };
+			}
+
+			/**
+			* @brief [-pi/4, pi/4]に還元した角度hi + loについて、sinとcosを上位と下位の2つの値で計算する
+			* @detail DがTより広くない組み込み型では、多項式の近似誤差が表の値に残らないようにdd<D>で評価する。
+			*         桁落ちで失う分を見込んでも、Dより16ビット多ければ足りる
+			* @return {sin, cos}
+			*/
+			template<typename T, typename D>
+			SPOOK_CONSTEVAL auto sincos_kernel_parts(D hi, D lo) -> std::pair<std::pair<D, D>, std::pair<D, D>> {
+				if constexpr (std::is_same_v<T, D> && cmath::detail::use_rounding_type<D, correctly_rounded_t>) {
+					using U = cmath::detail::evaluation_t<D, correctly_rounded_t>;
+					constexpr int digits = spook::numeric_limits_traits<D>::digits + 16;
+
+					const U x = cmath::detail::join_parts<U>(hi, lo);
+					const U sin_v = cmath::detail::sin_kernel<U, digits>(x, U{});
+					const U cos_v = cmath::detail::cos_kernel<U, digits>(x, U{});
+
+					return { { sin_v.hi, sin_v.lo }, { cos_v.hi, cos_v.lo } };
+				} else {
+					return { cmath::detail::sin_kernel_parts(hi, lo), cmath::detail::cos_kernel_parts(hi, lo) };
+				}
+			}
+
+			/**
+			* @brief 上位と下位に分かれた値x = hi + loについて、sinとcosを上位と下位の2つの値で計算する
+			* @detail hiだけを還元し、loは還元後の角度に足す
+			* @return {sin(x), cos(x)}
+			*/
+			template<typename T, typename D>
+			SPOOK_CONSTEVAL auto sincos_parts(const std::pair<D, D>& x) -> std::pair<std::pair<D, D>, std::pair<D, D>> {
+				const auto r = cmath::detail::reduce_pi_over_2(x.first);
+				const auto [s, s_err] = cmath::detail::two_sum(r.hi, x.second);
+				const auto [a_hi, a_lo] = cmath::detail::two_sum(s, s_err + r.lo);
+
+				const auto [sin_v, cos_v] = detail::sincos_kernel_parts<T>(a_hi, a_lo);
+
+				switch (r.quadrant) {
+				case 0:  return { sin_v, cos_v };
+				case 1:  return { cos_v, detail::negate_parts(sin_v) };
+				case 2:  return { detail::negate_parts(sin_v), detail::negate_parts(cos_v) };
+				default: return { detail::negate_parts(cos_v), sin_v };
+				}
+			}
+
+			/**
+			* @brief 上位と下位に分かれた値x = hi + loについて、sinまたはcosの一方だけを計算する
+			* @param Cosine trueならcos、falseならsin
+			*/
+			template<bool Cosine, typename D>
+			SPOOK_CONSTEVAL auto trig_parts(D hi, D lo) -> D {
+				const auto r = cmath::detail::reduce_pi_over_2(hi);
+				const auto [s, s_err] = cmath::detail::two_sum(r.hi, lo);
+				const auto [a_hi, a_lo] = cmath::detail::two_sum(s, s_err + r.lo);
+
+				//cos(x) = sin(x + pi/2)
+				switch ((r.quadrant + (Cosine ? 1 : 0)) & 3) {
+				case 0:  return  cmath::detail::sin_reduced<faithful_t>(a_hi, a_lo);
+				case 1:  return  cmath::detail::cos_reduced<faithful_t>(a_hi, a_lo);
+				case 2:  return -cmath::detail::sin_reduced<faithful_t>(a_hi, a_lo);
+				default: return -cmath::detail::cos_reduced<faithful_t>(a_hi, a_lo);
+				}
+			}
+
+			/**
+			* @brief 加法定理の和a + bの桁落ちが大きすぎるか
+			* @detail 失われる桁数が、DがTより広い分と2ビットの和を超えるなら、その点は直接計算し直す
+			*/
+			template<typename T, typename D>
+			SPOOK_CONSTEVAL auto is_cancelled(D a, D b) -> bool {
+				constexpr int margin = spook::numeric_limits_traits<D>::digits - spook::numeric_limits_traits<T>::digits + 2;
+				constexpr D ratio = cmath::detail::scale2(D(1.0), -margin);
+
+				//符号が同じなら桁落ちせず、異なれば|a| + |b| = |a - b|
+				if ((a < D(0.0)) == (b < D(0.0))) return false;
+
+				return spook::fabs(a + b) < spook::fabs(a - b) * ratio;
+			}
+
+			/**
+			* @brief sinまたはcosの表を加法定理で作る
+			* @detail 基準点x_kと、基準点からのずれj * h（j < sync_interval）のsin, cosだけを直接計算し、
+			*         sin(x_k + j * h) = sin(x_k) * cos(j * h) + cos(x_k) * sin(j * h)等で求める。
+			*         値も積も和も上位と下位の2つの値で持ち、Tへ丸めるのは最後の1回だけにする。
+			*         零点の近くで桁落ちする点だけは、その点で直接計算する
+			* @param Cosine trueならcos、falseならsin
+			*/
+			template<std::size_t N, bool Cosine, typename T>
+			SPOOK_CONSTEVAL auto trig_table(T lo, T hi) -> std::array<T, N> {
+				using D = detail::direct_t<T>;
+				constexpr std::size_t R = detail::sync_interval<N>;
+
+				const D step = D(detail::table_step(lo, hi, N));
+
+				std::array<std::pair<D, D>, R> offsets{};
+				std::array<product_operand<D>, R> sin_offsets{};
+				std::array<product_operand<D>, R> cos_offsets{};
+
+				for (std::size_t j = 0; j < R; ++j) {
+					offsets[j] = detail::exact_point(D(0.0), step, j);
+
+					const auto [sin_j, cos_j] = detail::sincos_parts<T>(offsets[j]);
+					sin_offsets[j] = detail::make_operand(sin_j);
+					cos_offsets[j] = detail::make_operand(cos_j);
+				}
+
+				std::array<T, N> table{};
+
+				for (std::size_t k = 0; k < N; k += R) {
+					const auto base = detail::exact_point(D(lo), step, k);
+					const auto [sin_k, cos_k] = detail::sincos_parts<T>(base);
+
+					//sinならsin_k * cos_j + cos_k * sin_j、cosならcos_k * cos_j - sin_k * sin_j
+					const auto u = detail::make_operand(Cosine ? cos_k : sin_k);
+					const auto w = detail::make_operand(Cosine ? detail::negate_parts(sin_k) : cos_k);
+
+					for (std::size_t j = 0; j < R && k + j < N; ++j) {
+						const auto [a, a_err] = detail::multiply_operands(u, cos_offsets[j]);
+						const auto [b, b_err] = detail::multiply_operands(w, sin_offsets[j]);
+
+						if (detail::is_cancelled<T>(a, b)) {
+							const auto [x_hi, x_err] = cmath::detail::two_sum(base.first, offsets[j].first);
+							table[k + j] = T(detail::trig_parts<Cosine>(x_hi, x_err + (base.second + offsets[j].second)));
+						} else {
+							const auto [sum, sum_err] = cmath::detail::two_sum(a, b);
+							table[k + j] = T(sum + (sum_err + (a_err + b_err)));
+						}
+					}
+				}
+
+				return table;
+			}
+
+			/**
+			* @brief expの表を指数法則で作れる範囲か
+			* @detail 両端の値とexp((sync_interval - 1) * h)が正規化数なら、途中の積もすべて正規化数に収まる
+			*/
+			template<std::size_t N, typename T>
+			SPOOK_CONSTEVAL auto is_exp_table_range(T lo, T hi) -> bool {
+				using D = detail::direct_t<T>;
+				constexpr std::size_t R = detail::sync_interval<N>;
+
+				const T step = detail::table_step(lo, hi, N);
+
+				return spook::isnormal(spook::exp(lo))
+					&& spook::isnormal(spook::exp(lo + step * T(N - 1)))
+					&& spook::isnormal(spook::exp(D(step) * D(R - 1)));
+			}
+
+			/**
+			* @brief exp(hi + lo) = 2^k * (上位 + 下位)を、2^kを掛ける前の2つの値で計算する
+			* @return {{上位, 下位}, k}
+			*/
+			template<typename D>
+			SPOOK_CONSTEVAL auto exp_parts(const std::pair<D, D>& x) -> std::pair<std::pair<D, D>, int> {
+				const auto r = cmath::detail::reduce_ln2(x.first);
+				const auto [r_hi, r_lo] = cmath::detail::fast_two_sum(r.hi, r.lo + x.second);
+				const auto [e_hi, e_lo] = cmath::detail::expm1_kernel(r_hi, r_lo);
+
+				//1 + e_hiの丸め誤差を下位に残す
+				const auto [s, s_err] = cmath::detail::two_sum(D(1.0), e_hi);
+
+				return { cmath::detail::fast_two_sum(s, s_err + e_lo), r.k };
+			}
+
+			/**
+			* @brief expの表を指数法則で作る
+			* @detail 基準点x_kと、基準点からのずれj * h（j < sync_interval）のexpだけを直接計算し、
+			*         exp(x_k + j * h) = exp(x_k) * exp(j * h)で求める。
+			*         値と積は2^kを除いた上位と下位の2つの値で持ち、2^kを掛けてTへ丸めるのは最後の1回だけにする
+			*/
+			template<std::size_t N, typename T>
+			SPOOK_CONSTEVAL auto exp_table(T lo, T hi) -> std::array<T, N> {
+				using D = detail::direct_t<T>;
+				constexpr std::size_t R = detail::sync_interval<N>;
+
+				const D step = D(detail::table_step(lo, hi, N));
+
+				//ずれのexpは正規化数に収まるので、2^kを掛けておく
+				std::array<product_operand<D>, R> offsets{};
+				for (std::size_t j = 0; j < R; ++j) {
+					const auto [exp_j, e_j] = detail::exp_parts(detail::exact_point(D(0.0), step, j));
+					offsets[j] = detail::make_operand(std::pair<D, D>{ spook::ldexp(exp_j.first, e_j), spook::ldexp(exp_j.second, e_j) });
+				}
+
+				std::array<T, N> table{};
+
+				for (std::size_t k = 0; k < N; k += R) {
+					const auto [exp_k, e_k] = detail::exp_parts(detail::exact_point(D(lo), step, k));
+					const auto base = detail::make_operand(exp_k);
+
+					for (std::size_t j = 0; j < R && k + j < N; ++j) {
+						const auto [p, p_err] = detail::multiply_operands(base, offsets[j]);
+						table[k + j] = T(spook::ldexp(p + p_err, e_k));
+					}
+				}
+
+				return table;
+			}
+		}
+
+		/**
+		* @brief 関数fを[lo, hi]上の等間隔なN点で標本化した表を作る
+		* @param f Tを受け取る関数オブジェクト
+		* @return i番目はf(lo + i * h)、hは(hi - lo) / (N - 1)をTに丸めた刻み幅（N == 1ならf(lo)のみ）
+		*/
+		template<std::size_t N, typename F, typename T CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto make_table(F f, T lo, T hi) -> std::array<T, N> {
+			return detail::sample_table<N>(f, lo, hi);
+		}
+
+		/**
+		* @brief 関数fを[lo, hi]上の等間隔なN点で標本化した表を作る
+		* @detail fがspook::sin<T>, spook::cos<T>, spook::exp<T>なら、各点で関数を評価する代わりに
+		*         sync_interval毎の基準点と基準点からのずれの値だけを直接計算し、加法定理により組み合わせる（floatはdoubleで計算する）。
+		*         値と積は上位と下位の2つの値で持ってTへの丸めは最後の1回だけなので、各点は標本点lo + i * hを丸めずに評価した真の値との差が1ulp未満になる
+		*         （double, doubleの[0, 1e6]のsinと[-700, 700]のexpで最大0.52ulpと0.68ulp）。
+		*         標本点をTに丸めてから評価するf(lo + i * h)とは、標本点の丸め誤差の分だけ異なることがある
+		* @param f 1引数の関数へのポインタ
+		* @return i番目はf(lo + i * h)、hは(hi - lo) / (N - 1)をTに丸めた刻み幅（N == 1ならf(lo)のみ）
+		*/
+		template<std::size_t N, typename T CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto make_table(T(*f)(T), T lo, T hi) -> std::array<T, N> {
+			using fn_t = T(*)(T);
+
+			if constexpr (2 <= N && std::is_floating_point_v<T>) {
+				if (spook::isfinite(lo) && spook::isfinite(hi)) {
+					if (f == static_cast<fn_t>(&spook::sin<T>)) return detail::trig_table<N, false>(lo, hi);
+					if (f == static_cast<fn_t>(&spook::cos<T>)) return detail::trig_table<N, true>(lo, hi);
+					if (f == static_cast<fn_t>(&spook::exp<T>) && detail::is_exp_table_range<N>(lo, hi)) return detail::exp_table<N>(lo, hi);
+				}
+			}
+
+			return detail::sample_table<N>(f, lo, hi);
+		}
+
+		inline namespace interpolation {
+
+			/**
+			* @brief 隣り合う2点の線形補間、誤差はO(h^2)
+			*/
+			struct linear_t {
+				explicit linear_t() = default;
+			};
+
+			/**
+			* @brief 最も近い点とその両隣の3点を通る2次式による補間、誤差はO(h^3)
+			*/
+			struct quadratic_t {
+				explicit quadratic_t() = default;
+			};
+
+			/**
+			* @brief 両端の値と傾きを通る3次式（3次エルミート補間）、誤差はO(h^4)
+			* @detail 傾きは表の値から5点の差分で求める
+			*/
+			struct cubic_hermite_t {
+				explicit cubic_hermite_t() = default;
+			};
+
+			inline constexpr linear_t linear{};
+			inline constexpr quadratic_t quadratic{};
+			inline constexpr cubic_hermite_t cubic_hermite{};
+
+			/**
+			* @brief 補間方法を表す型かを調べる
+			*/
+			template<typename Interp>
+			struct is_interpolation : std::disjunction<
+				std::is_same<Interp, linear_t>,
+				std::is_same<Interp, quadratic_t>,
+				std::is_same<Interp, cubic_hermite_t>
+			> {};
+
+			template<typename Interp>
+			inline constexpr bool is_interpolation_v = is_interpolation<Interp>::value;
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 1引数の関数（ポインタ、関数オブジェクト）の引数の型
+			*/
+			template<typename F>
+			struct function_argument : function_argument<decltype(&F::operator())> {};
+
+			template<typename R, typename A>
+			struct function_argument<R(*)(A)> {
+				using type = A;
+			};
+
+			template<typename R, typename C, typename A>
+			struct function_argument<R(C::*)(A) const> {
+				using type = A;
+			};
+
+			template<typename F>
+			using function_argument_t = std::remove_cv_t<std::remove_reference_t<typename function_argument<F>::type>>;
+
+			/**
+			* @brief 補間多項式の次数
+			*/
+			template<typename Interp>
+			inline constexpr std::size_t interpolation_order = std::is_same_v<Interp, linear_t> ? 1 : std::is_same_v<Interp, quadratic_t> ? 2 : 3;
+
+			/**
+			* @brief 誤差を求める際に、1区間あたりに評価する点の数
+			* @detail 区間を等分した内点で評価する。どの補間も誤差が最大になりやすい区間の中央を含むよう奇数にする
+			*/
+			inline constexpr std::size_t error_samples = 3;
+
+			/**
+			* @brief 誤差の上界で、表の差分から見積もった導関数の大きさに掛ける余裕
+			*/
+			inline constexpr double derivative_margin = 2.0;
+		}
+
+		/**
+		* @brief コンパイル時に作った表を補間して関数を近似する関数オブジェクト
+		* @detail 区間ごとの補間多項式の係数を持ち、呼び出しは分岐なしの添字計算とホーナー法だけで行う。
+		*         構築時に補間の剰余項と丸め誤差から最大絶対誤差の上界を求めるので、static_assertで精度を確かめられる
+		* @tparam F 近似する関数、spook::sin<double>等の関数ポインタまたはキャプチャしないラムダ式
+		* @tparam N 表の点数
+		* @tparam Interp linear_t, quadratic_t, cubic_hermite_tのいずれか
+		*/
+		template<auto F, std::size_t N, typename Interp = linear_t>
+		class table_function {
+			static_assert(spook::is_interpolation_v<Interp>, "Interp must be linear_t, quadratic_t or cubic_hermite_t.");
+
+			using T = detail::function_argument_t<decltype(F)>;
+
+			static constexpr std::size_t order = detail::interpolation_order<Interp>;
+
+			//2次補間は中央の点ごと、それ以外は隣り合う2点の間ごとに多項式を持つ
+			static constexpr std::size_t segments = std::is_same_v<Interp, quadratic_t> ? N - 2 : N - 1;
+
+			static_assert(order + 1 <= N && (!std::is_same_v<Interp, cubic_hermite_t> || 5 <= N), "N is too small for the interpolation.");
+
+			std::array<std::array<T, order + 1>, segments> m_coefficients{};
+			T m_lo{};
+			T m_inv_step{};
+			T m_sampled_error{};
+			T m_error_bound{};
+
+			/**
+			* @brief 区間ごとの補間の剰余項と丸め誤差の和の最大値
+			* @detail k階の前進差分はΔ^k f_j = h^k * f^(k)(ξ)（ξは[x_j, x_{j+k}]内）なので、区間の節点と重なる差分の最大値に
+			*         ξからのずれによる変化（k + 1階の差分の(k + 1)倍）を加え、derivative_marginを掛けてh^k * |f^(k)|の上限とする。剰余項は線形 h^2 |f^(2)| / 8、2次 h^3 |f^(3)| * 0.385 / 6、
+			*         3次エルミート h^4 |f^(4)| / 384に、差分で求めた傾きの誤差（h^5 |f^(5)|の1/30～1/5倍）による分を加えたもの
+			*/
+			static constexpr auto estimate_bound(const std::array<T, N>& f) -> T {
+				//k + 1階の差分も使う
+				constexpr std::size_t max_order = std::is_same_v<Interp, cubic_hermite_t> ? 6 : order + 2;
+
+				//d[k][j] = Δ^k f_j
+				std::array<std::array<T, N>, max_order + 1> d{};
+				d[0] = f;
+				for (std::size_t k = 1; k <= max_order && k < N; ++k) {
+					for (std::size_t j = 0; j + k < N; ++j) d[k][j] = d[k - 1][j + 1] - d[k - 1][j];
+				}
+
+				//節点[first, last]と重なるk階差分の最大の大きさ
+				const auto difference = [&d](std::size_t k, std::size_t first, std::size_t last) -> T {
+					T m{};
+					if (N <= k) return m;
+
+					const std::size_t end = (last + k < N) ? last : N - 1 - k;
+					for (std::size_t j = (first < k) ? 0 : first - k; j <= end; ++j) {
+						const T a = spook::fabs(d[k][j]);
+						if (m < a) m = a;
+					}
+					return m;
+				};
+
+				//h^k * |f^(k)|の上限、ξからの距離は(k + 1)h未満なので、k + 1階の差分による変化を加える
+				const auto derivative = [&difference](std::size_t k, std::size_t first, std::size_t last) -> T {
+					return T(detail::derivative_margin) * (difference(k, first, last) + T(double(k + 1)) * difference(k + 1, first, last));
+				};
+
+				//3次エルミートの傾きの誤差のh^5 |f^(5)|に対する係数、端は片側の差分
+				const auto slope_error = [](std::size_t j) -> T {
+					if (j == 0 || j == N - 1) return T(1.0) / T(5.0);
+					if (j == 1 || j == N - 2) return T(1.0) / T(20.0);
+					return T(1.0) / T(30.0);
+				};
+
+				T bound{};
+
+				for (std::size_t i = 0; i < segments; ++i) {
+					//区間の多項式が使う節点
+					const std::size_t first = i;
+					const std::size_t last = i + (std::is_same_v<Interp, quadratic_t> ? 2 : 1);
+
+					T interpolation{};
+					if constexpr (std::is_same_v<Interp, linear_t>) {
+						interpolation = derivative(2, first, last) / T(8.0);
+					} else if constexpr (std::is_same_v<Interp, quadratic_t>) {
+						//|(s + 1)s(s - 1)|の最大値は、端の区間の外挿を含めて0.385未満
+						interpolation = derivative(3, first, last) * T(0.385) / T(6.0);
+					} else {
+						//傾きの誤差は基底関数s(1 - s)^2等（最大4/27）を介して効く
+						const T slope = (slope_error(first) + slope_error(last)) * T(4.0) / T(27.0);
+						const std::size_t stencil_first = (first < 2) ? 0 : first - 2;
+						const std::size_t stencil_last = (last + 2 < N) ? last + 2 : N - 1;
+						interpolation = derivative(4, first, last) / T(384.0) + slope * derivative(5, stencil_first, stencil_last);
+					}
+
+					//表の値は1ulp未満なので、係数とホーナー法の丸めを合わせて4 * (order + 1)ulpとする
+					T magnitude{};
+					for (std::size_t j = first; j <= last; ++j) {
+						if (magnitude < spook::fabs(f[j])) magnitude = spook::fabs(f[j]);
+					}
+					const T rounding = T(4.0 * (order + 1)) * spook::numeric_limits_traits<T>::epsilon() * magnitude;
+
+					if (bound < interpolation + rounding) bound = interpolation + rounding;
+				}
+
+				return bound;
+			}
+
+			/**
+			* @brief 表の値から区間ごとの補間多項式の係数を求める
+			*/
+			constexpr void build(const std::array<T, N>& f) {
+				if constexpr (std::is_same_v<Interp, linear_t>) {
+					for (std::size_t i = 0; i < segments; ++i) {
+						m_coefficients[i] = { f[i], f[i + 1] - f[i] };
+					}
+				} else if constexpr (std::is_same_v<Interp, quadratic_t>) {
+					//中央の点cからのずれuについてのラグランジュ補間
+					for (std::size_t i = 0; i < segments; ++i) {
+						const std::size_t c = i + 1;
+						m_coefficients[i] = { f[c], (f[c + 1] - f[c - 1]) / T(2.0), (f[c + 1] - T(2.0) * f[c] + f[c - 1]) / T(2.0) };
+					}
+				} else {
+					//刻み幅を掛けた傾き、端の2点は片側の5点の差分による
+					std::array<T, N> m{};
+
+					m[0] = (T(-25.0) * f[0] + T(48.0) * f[1] - T(36.0) * f[2] + T(16.0) * f[3] - T(3.0) * f[4]) / T(12.0);
+					m[1] = (T(-3.0) * f[0] - T(10.0) * f[1] + T(18.0) * f[2] - T(6.0) * f[3] + f[4]) / T(12.0);
+
+					for (std::size_t i = 2; i < N - 2; ++i) {
+						m[i] = (f[i - 2] - T(8.0) * f[i - 1] + T(8.0) * f[i + 1] - f[i + 2]) / T(12.0);
+					}
+
+					m[N - 2] = (T(3.0) * f[N - 1] + T(10.0) * f[N - 2] - T(18.0) * f[N - 3] + T(6.0) * f[N - 4] - f[N - 5]) / T(12.0);
+					m[N - 1] = (T(25.0) * f[N - 1] - T(48.0) * f[N - 2] + T(36.0) * f[N - 3] - T(16.0) * f[N - 4] + T(3.0) * f[N - 5]) / T(12.0);
+
+					for (std::size_t i = 0; i < segments; ++i) {
+						const T d = f[i + 1] - f[i];
+						m_coefficients[i] = { f[i], m[i], T(3.0) * d - T(2.0) * m[i] - m[i + 1], m[i] + m[i + 1] - T(2.0) * d };
+					}
+				}
+			}
+
+		public:
+
+			/**
+			* @brief [lo, hi]上のN点の表を作り、補間多項式と誤差の上界、標本点での誤差を求める
+			* @param lo 表の下端
+			* @param hi 表の上端
+			*/
+			constexpr table_function(T lo, T hi) : m_lo(lo), m_inv_step(T(N - 1) / (hi - lo)) {
+				const auto f = spook::make_table<N>(F, lo, hi);
+				this->build(f);
+				m_error_bound = table_function::estimate_bound(f);
+
+				const T step = detail::table_step(lo, hi, N);
+
+				for (std::size_t i = 0; i + 1 < N; ++i) {
+					for (std::size_t k = 0; k < detail::error_samples; ++k) {
+						const T x = lo + step * (T(i) + T(k + 1) / T(detail::error_samples + 1));
+						const T error = spook::fabs((*this)(x) - T(F(x)));
+
+						if (m_sampled_error < error) m_sampled_error = error;
+					}
+				}
+			}
+
+			/**
+			* @brief 表を補間した値
+			* @detail [lo, hi]の外は端の区間の多項式で外挿する。ただし整数に変換できないほど遠い点（無限大を含む）では区間を選べない
+			*/
+			constexpr auto operator()(T x) const -> T {
+				const T t = (x - m_lo) * m_inv_step;
+
+				//区間の番号（2次補間では中央の点の番号）は、整数にしてから範囲に収めると分岐しない（cmov）
+				constexpr std::ptrdiff_t first = std::is_same_v<Interp, quadratic_t> ? 1 : 0;
+				constexpr std::ptrdiff_t last = first + std::ptrdiff_t(segments) - 1;
+
+				std::ptrdiff_t n = static_cast<std::ptrdiff_t>(std::is_same_v<Interp, quadratic_t> ? t + T(0.5) : t);
+				n = (n < first) ? first : n;
+				n = (last < n) ? last : n;
+
+				const T s = t - T(n);
+
+				const auto& c = m_coefficients[std::size_t(n) - std::size_t(first)];
+				T result = c[order];
+
+				for (std::size_t k = order; 0 < k; --k) {
+					result = result * s + c[k - 1];
+				}
+
+				return result;
+			}
+
+			/**
+			* @brief 構築時に求めた、[lo, hi]での最大絶対誤差の上界
+			* @detail 補間の剰余項と丸め誤差の和で、剰余項の導関数の大きさは表の差分にderivative_marginの余裕を掛けて見積もる。
+			*         導関数が節点数個の間に2倍より大きく変わる（表の刻みで分解できない変動を持つ）関数では上界にならない
+			*/
+			constexpr auto error_bound() const -> T {
+				return m_error_bound;
+			}
+
+			/**
+			* @brief 構築時に求めた、[lo, hi]の標本点での最大絶対誤差
+			* @detail 各区間のerror_samples点で元の関数と比べた値で、区間全体の誤差の上界ではない。error_bound()の見積もりの確認に使う
+			*/
+			constexpr auto sampled_error() const -> T {
+				return m_sampled_error;
+			}
+		};
+	}
+
+	inline namespace polynomial {
+
+		namespace detail {
+
+			/**
+			* @brief 係数を求める計算に使う型、floatはdouble、それ以外はT
+			*/
+			template<typename T>
+			using fit_t = table::detail::direct_t<T>;
+
+			/**
+			* @brief チェビシェフ多項式T_0(t), ..., T_{N-1}(t)の値
+			*/
+			template<std::size_t N, typename W>
+			SPOOK_CONSTEVAL auto chebyshev_values(W t) -> std::array<W, N> {
+				std::array<W, N> v{};
+
+				v[0] = W(1.0);
+				if constexpr (1 < N) v[1] = t;
+
+				for (std::size_t j = 2; j < N; ++j) {
+					v[j] = W(2.0) * t * v[j - 1] - v[j - 2];
+				}
+
+				return v;
+			}
+
+			/**
+			* @brief チェビシェフ級数c_0 T_0(t) + ... + c_{N-1} T_{N-1}(t)の値（Clenshawの方法）
+			*/
+			template<std::size_t N, typename W>
+			SPOOK_CONSTEVAL auto chebyshev_sum(const std::array<W, N>& c, W t) -> W {
+				W b1{}, b2{};
+
+				for (std::size_t j = N - 1; 0 < j; --j) {
+					const W b0 = W(2.0) * t * b1 - b2 + c[j];
+					b2 = b1;
+					b1 = b0;
+				}
+
+				return t * b1 - b2 + c[0];
+			}
+
+			/**
+			* @brief [a, b]のチェビシェフ級数の係数を、xについての単項式の係数（昇順）に直す
+			* @detail tについて展開してから、t = (2x - a - b) / (b - a)を代入する
+			*/
+			template<typename T, std::size_t N, typename W>
+			SPOOK_CONSTEVAL auto chebyshev_to_monomial(const std::array<W, N>& c, W a, W b) -> std::array<T, N> {
+				//T_j(t)の係数をT_{j+1} = 2t T_j - T_{j-1}で作りながら、tについての係数に足し込む
+				std::array<W, N> in_t{};
+				std::array<W, N> prev{};
+				std::array<W, N> curr{};
+				curr[0] = W(1.0);
+
+				for (std::size_t j = 0; j < N; ++j) {
+					for (std::size_t k = 0; k < N; ++k) in_t[k] += c[j] * curr[k];
+
+					std::array<W, N> next{};
+					for (std::size_t k = 0; k < N; ++k) {
+						next[k] = ((0 < k) ? (j == 0 ? W(1.0) : W(2.0)) * curr[k - 1] : W(0.0)) - prev[k];
+					}
+
+					prev = curr;
+					curr = next;
+				}
+
+				//ホーナー法でt = alpha x + betaを代入する
+				const W alpha = W(2.0) / (b - a);
+				const W beta = -(a + b) / (b - a);
+				std::array<W, N> in_x{};
+
+				for (std::size_t j = N; 0 < j; --j) {
+					for (std::size_t k = N - 1; 0 < k; --k) {
+						in_x[k] = in_x[k] * beta + in_x[k - 1] * alpha;
+					}
+					in_x[0] = in_x[0] * beta + in_t[j - 1];
+				}
+
+				std::array<T, N> result{};
+				for (std::size_t k = 0; k < N; ++k) result[k] = T(in_x[k]);
+
+				return result;
+			}
+
+			/**
+			* @brief 連立一次方程式A x = yを部分ピボット選択付きのガウスの消去法で解く
+			*/
+			template<std::size_t M, typename W>
+			SPOOK_CONSTEVAL auto solve_linear(std::array<std::array<W, M>, M> A, std::array<W, M> y) -> std::array<W, M> {
+				for (std::size_t col = 0; col < M; ++col) {
+					std::size_t pivot = col;
+					for (std::size_t row = col + 1; row < M; ++row) {
+						if (spook::fabs(A[pivot][col]) < spook::fabs(A[row][col])) pivot = row;
+					}
+
+					std::swap(A[col], A[pivot]);
+					std::swap(y[col], y[pivot]);
+
+					for (std::size_t row = col + 1; row < M; ++row) {
+						const W r = A[row][col] / A[col][col];
+						for (std::size_t k = col; k < M; ++k) A[row][k] -= r * A[col][k];
+						y[row] -= r * y[col];
+					}
+				}
+
+				std::array<W, M> x{};
+				for (std::size_t row = M; 0 < row; --row) {
+					const std::size_t i = row - 1;
+					W s = y[i];
+					for (std::size_t k = i + 1; k < M; ++k) s -= A[i][k] * x[k];
+					x[i] = s / A[i][i];
+				}
+
+				return x;
+			}
+
+			/**
+			* @brief 誤差の極値を探す格子の、参照点1つあたりの点数
+			*/
+			inline constexpr std::size_t remez_grid_density = 64;
+
+			/**
+			* @brief Remezのアルゴリズムの反復回数の上限
+			*/
+			inline constexpr int remez_max_iterations = 20;
+
+			/**
+			* @brief Hornerの方法、Xはスカラーかspook::simd
+			*/
+			template<typename T, std::size_t N, typename X>
+			SPOOK_CONSTEVAL auto horner_sum(const std::array<T, N>& c, const X& x) -> X {
+				static_assert(0 < N, "polynomial requires at least one coefficient.");
+
+				X r = X(c[N - 1]);
+				for (std::size_t k = N - 1; 0 < k; --k) {
+					r = r * x + X(c[k - 1]);
+				}
+				return r;
+			}
+
+			/**
+			* @brief n未満の最大の2の冪、Estrinの方法で係数列を前後に分ける位置
+			* @return {2の冪, その指数}
+			*/
+			SPOOK_CONSTEVAL auto estrin_split(std::size_t n) -> std::pair<std::size_t, std::size_t> {
+				std::size_t h = 1, level = 0;
+				while (2 * h < n) {
+					h *= 2;
+					++level;
+				}
+				return { h, level };
+			}
+
+			/**
+			* @brief c_First + ... + c_{First+Count-1} x^{Count-1}をEstrinの方法で計算する
+			* @param powers {x, x^2, x^4, ...}
+			* @detail 前半と後半を独立に計算してx^(2^k)で繋ぐので、依存関係の連鎖がlog2(Count)段になる
+			*/
+			template<std::size_t First, std::size_t Count, typename T, std::size_t N, typename X, std::size_t L>
+			SPOOK_CONSTEVAL auto estrin_sum(const std::array<T, N>& c, const std::array<X, L>& powers) -> X {
+				if constexpr (Count == 1) {
+					return X(c[First]);
+				} else {
+					constexpr auto split = detail::estrin_split(Count);
+					return detail::estrin_sum<First, split.first>(c, powers) + detail::estrin_sum<First + split.first, Count - split.first>(c, powers) * powers[split.second];
+				}
+			}
+
+			/**
+			* @brief Estrinの方法、Xはスカラーかspook::simd
+			*/
+			template<typename T, std::size_t N, typename X>
+			SPOOK_CONSTEVAL auto estrin_sum(const std::array<T, N>& c, const X& x) -> X {
+				static_assert(0 < N, "polynomial requires at least one coefficient.");
+
+				constexpr std::size_t L = detail::estrin_split(N).second + 1;
+
+				std::array<X, L> powers{};
+				powers[0] = x;
+				for (std::size_t j = 1; j < L; ++j) powers[j] = powers[j - 1] * powers[j - 1];
+
+				return detail::estrin_sum<0, N>(c, powers);
+			}
+
+			/**
+			* @brief 補正付きHornerの方法（Graillat, Langlois, Louvet）
+			* @param prod 誤差なしの乗算、{a * b, 誤差}を返す
+			* @detail 各段の乗算と加算の丸め誤差を別のHornerの方法で集めて最後に足す。結果は2倍の精度で計算してから丸めた程度の精度になる
+			*/
+			template<typename T, std::size_t N, typename X, typename Prod>
+			SPOOK_CONSTEVAL auto compensated_horner_sum(const std::array<T, N>& c, const X& x, Prod prod) -> X {
+				static_assert(0 < N, "polynomial requires at least one coefficient.");
+
+				X s = X(c[N - 1]);
+				X e = X(T(0.0));
+
+				for (std::size_t k = N - 1; 0 < k; --k) {
+					const auto [p, p_err] = prod(s, x);
+					const auto [t, s_err] = cmath::detail::two_sum(p, X(c[k - 1]));
+					s = t;
+					e = e * x + (p_err + s_err);
+				}
+
+				return s + e;
+			}
+		}
+
+		/**
+		* @brief fを[a, b]のチェビシェフ点で補間するDegree次多項式の係数
+		* @detail T_{Degree+1}の零点での補間で、最良近似に近い多項式が得られる
+		* @param f Tを受け取る関数オブジェクト、spook::exp<double>等
+		* @return xについての単項式の係数{c_0, c_1, ..., c_Degree}（c_0 + c_1 x + ...）
+		*/
+		template<std::size_t Degree, typename F, typename T CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto chebyshev_fit(F f, T a, T b) -> std::array<T, Degree + 1> {
+			using W = detail::fit_t<T>;
+			constexpr std::size_t N = Degree + 1;
+
+			const W mid = (W(a) + W(b)) / W(2.0);
+			const W half = (W(b) - W(a)) / W(2.0);
+
+			std::array<W, N> c{};
+
+			for (std::size_t k = 0; k < N; ++k) {
+				const W t = spook::cos(constant::pi<W> * (W(k) + W(0.5)) / W(N));
+				const W y = W(f(T(mid + half * t)));
+				const auto v = detail::chebyshev_values<N>(t);
+
+				for (std::size_t j = 0; j < N; ++j) c[j] += y * v[j];
+			}
+
+			for (std::size_t j = 0; j < N; ++j) {
+				c[j] *= ((j == 0) ? W(1.0) : W(2.0)) / W(N);
+			}
+
+			return detail::chebyshev_to_monomial<T>(c, W(a), W(b));
+		}
+
+		/**
+		* @brief fを[a, b]で最大絶対誤差が最小になるように近似するDegree次多項式の係数
+		* @detail Remezの交換法による。誤差の極値は格子上で探して放物線で補正し、
+		*         参照点での誤差の大きさが0.1%以内で揃うか、remez_max_iterations回で打ち切る
+		* @param f Tを受け取る関数オブジェクト、spook::exp<double>等
+		* @return xについての単項式の係数{c_0, c_1, ..., c_Degree}（c_0 + c_1 x + ...）
+		*/
+		template<std::size_t Degree, typename F, typename T CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto minimax_fit(F f, T a, T b) -> std::array<T, Degree + 1> {
+			using W = detail::fit_t<T>;
+			constexpr std::size_t N = Degree + 1;
+			constexpr std::size_t M = Degree + 2;
+			constexpr std::size_t G = detail::remez_grid_density * M;
+
+			const W mid = (W(a) + W(b)) / W(2.0);
+			const W half = (W(b) - W(a)) / W(2.0);
+			const auto func = [&](W t) { return W(f(T(mid + half * t))); };
+
+			//格子と参照点は、端が密になるようt = -cos(θ)のθについて等間隔に取る
+			const auto grid_point = [](W theta) { return -spook::cos(theta); };
+			const W d_theta = constant::pi<W> / W(G);
+
+			std::array<W, M> ref{};
+			for (std::size_t k = 0; k < M; ++k) ref[k] = grid_point(constant::pi<W> * W(k) / W(M - 1));
+
+			std::array<W, N> c{};
+
+			//誤差が丸め誤差と同程度になると交換が収束しないので、格子上の最大誤差が最小だった係数を返す
+			std::array<W, N> best{};
+			W best_error = std::numeric_limits<W>::infinity();
+
+			for (int iteration = 0; iteration < detail::remez_max_iterations; ++iteration) {
+				//参照点で誤差が±Eと交互になる多項式を求める
+				std::array<std::array<W, M>, M> A{};
+				std::array<W, M> y{};
+
+				for (std::size_t k = 0; k < M; ++k) {
+					const auto v = detail::chebyshev_values<N>(ref[k]);
+					for (std::size_t j = 0; j < N; ++j) A[k][j] = v[j];
+					A[k][N] = (k % 2 == 0) ? W(1.0) : W(-1.0);
+					y[k] = func(ref[k]);
+				}
+
+				const auto solution = detail::solve_linear(A, y);
+				for (std::size_t j = 0; j < N; ++j) c[j] = solution[j];
+
+				//格子上の誤差を、符号が変わらない区間ごとに|誤差|が最大の点にまとめる
+				std::array<W, G + 1> errors{};
+				for (std::size_t i = 0; i <= G; ++i) {
+					const W t = grid_point(d_theta * W(i));
+					errors[i] = detail::chebyshev_sum(c, t) - func(t);
+				}
+
+				W grid_error{};
+				for (std::size_t i = 0; i <= G; ++i) {
+					grid_error = (grid_error < spook::fabs(errors[i])) ? spook::fabs(errors[i]) : grid_error;
+				}
+				if (grid_error < best_error) {
+					best = c;
+					best_error = grid_error;
+				}
+
+				std::array<W, G + 1> points{};
+				std::array<W, G + 1> values{};
+				std::size_t count = 0;
+
+				for (std::size_t i = 0; i <= G; ++i) {
+					//極大の位置を前後の点を通る放物線の頂点で補正する
+					W theta = d_theta * W(i);
+					W value = errors[i];
+
+					if (0 < i && i < G && spook::fabs(errors[i - 1]) <= spook::fabs(value) && spook::fabs(errors[i + 1]) <= spook::fabs(value)) {
+						const W curvature = errors[i - 1] - W(2.0) * errors[i] + errors[i + 1];
+						if (curvature != W(0.0)) {
+							const W shift = (errors[i - 1] - errors[i + 1]) / (W(2.0) * curvature);
+							if (spook::fabs(shift) < W(1.0)) {
+								theta += shift * d_theta;
+								value -= (errors[i - 1] - errors[i + 1]) * shift / W(4.0);
+							}
+						}
+					}
+
+					if (0 < count && spook::signbit(values[count - 1]) == spook::signbit(errors[i])) {
+						if (spook::fabs(values[count - 1]) < spook::fabs(value)) {
+							points[count - 1] = grid_point(theta);
+							values[count - 1] = value;
+						}
+					} else {
+						points[count] = grid_point(theta);
+						values[count] = value;
+						++count;
+					}
+				}
+
+				//誤差の符号の交代がM回に満たなければ、これ以上改善できない
+				if (count < M) break;
+
+				//交互の符号を保ったまま、小さな極値をM個になるまで除く
+				while (M < count) {
+					std::size_t smallest = 0;
+					for (std::size_t i = 1; i < count; ++i) {
+						if (spook::fabs(values[i]) < spook::fabs(values[smallest])) smallest = i;
+					}
+
+					std::size_t first = smallest;
+					std::size_t removed = 1;
+
+					if (0 < smallest && smallest < count - 1) {
+						if (count - M == 1) {
+							//内側は2つずつしか除けないので、残り1つなら端の小さい方を除く
+							first = (spook::fabs(values[0]) < spook::fabs(values[count - 1])) ? 0 : count - 1;
+						} else {
+							//内側は隣の小さい方と2つまとめて除く
+							first = (spook::fabs(values[smallest + 1]) < spook::fabs(values[smallest - 1])) ? smallest : smallest - 1;
+							removed = 2;
+						}
+					}
+
+					for (std::size_t i = first; i + removed < count; ++i) {
+						points[i] = points[i + removed];
+						values[i] = values[i + removed];
+					}
+					count -= removed;
+				}
+
+				W max_error{}, min_error = spook::fabs(values[0]);
+				for (std::size_t k = 0; k < M; ++k) {
+					ref[k] = points[k];
+					max_error = (max_error < spook::fabs(values[k])) ? spook::fabs(values[k]) : max_error;
+					min_error = (spook::fabs(values[k]) < min_error) ? spook::fabs(values[k]) : min_error;
+				}
+
+				if (max_error - min_error <= max_error / W(1024.0)) break;
+			}
+
+			return detail::chebyshev_to_monomial<T>(best, W(a), W(b));
+		}
+
+		/**
+		* @brief 多項式c_0 + c_1 x + ... + c_{N-1} x^{N-1}の値（Hornerの方法）
+		* @param c 係数（昇順）、chebyshev_fitやminimax_fitの結果をそのまま渡せる
+		* @param x 変数
+		* @detail spook::simd版とspook::batch版がある
+		*/
+		template<typename T, std::size_t N CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto horner(const std::array<T, N>& c, T x) -> T {
+			return detail::horner_sum(c, x);
+		}
+
+		/**
+		* @brief 多項式c_0 + c_1 x + ... + c_{N-1} x^{N-1}の値（Estrinの方法）
+		* @detail 乗算の回数はHornerの方法より多いが、依存関係の連鎖が短く命令レベルの並列性を使える。丸め誤差はHornerの方法と同程度
+		*/
+		template<typename T, std::size_t N CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto estrin(const std::array<T, N>& c, T x) -> T {
+			return detail::estrin_sum(c, x);
+		}
+
+		/**
+		* @brief 多項式c_0 + c_1 x + ... + c_{N-1} x^{N-1}の値（補正付きHornerの方法）
+		* @detail Tの2倍の精度で計算してから丸めた程度の精度になる。悪条件の点（根の近く等）でもHornerの方法より誤差が小さい
+		*/
+		template<typename T, std::size_t N CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto compensated_horner(const std::array<T, N>& c, T x) -> T {
+			return detail::compensated_horner_sum(c, x, [](T a, T b) { return cmath::detail::two_prod(a, b); });
+		}
+	}
+
+	inline namespace bit {
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto countr_zero(T x) -> int;
+	}
+
+	inline namespace numeric {
+
+		namespace detail {
+
+			struct mod_def {
+
+				template<typename T>
+				SPOOK_CONSTEVAL auto operator()(T m, T n) -> T {
+					if constexpr (spook::is_floating_point_v<T>) {
+						return spook::fmod(m, n);
+					} else {
+						return m % n;
+					}
+				}
+			};
+			
+			/**
+			* @brief ユークリッドの互除法によるジェネリックな実装
+			* @detail 型Rはdoubleからの変換が可能であり、コピー（ムーブ）構築・代入が可能である必要がある
+			* @param m, n 最大公約数を求める値のペア、前処理済
+			* @param mod 剰余を求める関数オブジェクト
+			* @return GCD
+			*/
+			template <typename R, typename Mod>
+			SPOOK_CONSTEVAL auto gcd_impl(R m, R n, Mod mod) -> R {
+				const R zero = R(0.0);
+
+				do {
+					R oldn = n;
+					n = mod(m ,n);
+					m = oldn;
+				} while (n != zero);
+
+				return R(m);
+			}
+
+			/**
+			* @brief 符号なし整数型用の効率的な実装
+			* @param m, n 最大公約数を求める値のペア、前処理済
+			* @return GCD
+			*/
+			template <typename I>
+			SPOOK_CONSTEVAL auto gcd_impl(I m, I n) -> I {
+				//素の値を取り出す（2^n倍を出来るだけ戻す）
+				const auto m_zeros = spook::countr_zero(m);
+				m >>= m_zeros;
+				const auto common_zeros = std::min(m_zeros, spook::countr_zero(n));
+				n >>= common_zeros;
+
+				do {
+					//nの素の値を取り出す（2^nで割る）
+					n >>= spook::countr_zero(n);
+
+					//常にnが大きくなるようにswap
+					if (n < m) {
+						auto temp = m;
+						m = n;
+						n = temp;
+					}
+
+					//大きい方から小さい方を引く、ゼロになるまで
+					n -= m;
+				} while (n != 0);
+
+				//最終的にゼロになった時に引いた数字が最大公約数（最初に素の値にした分を元に戻す）
+				return m << common_zeros;
+			}
+		}
+
+		template<typename M, typename N, typename Mod= detail::mod_def>
+		SPOOK_CONSTEVAL auto gcd(M mx, N nx, [[maybe_unused]] Mod&& mod = detail::mod_def{}) -> std::common_type_t<M, N> {
+			using R = std::common_type_t<M, N>;
+
+			if (spook::iszero(mx)) return R(nx);
+			if (spook::iszero(nx)) return R(mx);
+
+			if constexpr (spook::is_integral_v<M> && spook::is_integral_v<N>) {
+				using UR = std::make_unsigned_t<R>;
+
+				//整数型用の処理
+				UR abs_m = UR(spook::abs(mx));
+				UR abs_n = UR(spook::abs(nx));
+
+				return R(detail::gcd_impl(abs_m, abs_n));
+			} else {
+				const R abs_m = R(spook::abs(mx));
+				const R abs_n = R(spook::abs(nx));
+
+				R m = std::max(abs_m, abs_n);
+				R n = std::min(abs_m, abs_n);
+
+				return detail::gcd_impl(m, n, std::forward<Mod>(mod));
+			}
+		}
+
+		template <typename M, typename N, typename Mod= detail::mod_def>
+		SPOOK_CONSTEVAL auto lcm(M mx, N nx, [[maybe_unused]] Mod&& mod = detail::mod_def{}) -> std::common_type_t<M, N> {
+			using R = std::common_type_t<M, N>;
+
+			if (spook::iszero(mx) || spook::iszero(nx)) return R(0.0);
+
+			if constexpr (spook::is_integral_v<M> && spook::is_integral_v<N>){
+				using UR = std::make_unsigned_t<R>;
+				//整数型用の処理
+				UR abs_m = UR(spook::abs(mx));
 				UR abs_n = UR(spook::abs(nx));
 
-				//オーバーフロー対策に大きかろう方を先に割る
-				return R((abs_m / detail::gcd_impl(abs_m, abs_n)) * abs_n);
-			} else {
-				const R abs_m = R(spook::abs(mx));
-				const R abs_n = R(spook::abs(nx));
+				//オーバーフロー対策に大きかろう方を先に割る
+				return R((abs_m / detail::gcd_impl(abs_m, abs_n)) * abs_n);
+			} else {
+				const R abs_m = R(spook::abs(mx));
+				const R abs_n = R(spook::abs(nx));
+
+				R m = std::max(abs_m, abs_n);
+				R n = std::min(abs_m, abs_n);
+
+				//オーバーフロー対策に大きい方を先に割る
+				return R((m / detail::gcd_impl(m, n, std::forward<Mod>(mod))) * n);
+			}
+		}
+	}
+
+	inline namespace bit {
+
+		namespace detail {
+
+			/**
+			* @brief 任意の64ビット値を0~63の間に押し込めるハッシュ関数
+			* @detail 1ビットだけ立っている値に対しては完全ハッシュとなる、その出力は下のhash2posによってその桁位置に写すことができる
+			* @detail 詳細？http://supertech.csail.mit.edu/papers/debruijn.pdf
+			* @param x 入力
+			* @return [0, 63]の間の値
+			*/
+			SPOOK_CONSTEVAL auto hash_64(std::uint64_t x) -> int {
+				int h = (x * 0x03F566ED27179461UL) >> 58;
+				return h;
+			}
+
+			/**
+			* @brief hash_64()の出力を対応する桁位置へ変換
+			* @detail 求める簡易なもの -> https://wandbox.org/permlink/DKLoL1qKgiwTrugE
+			*/
+			inline constexpr char hash2pos[] = {1, 2, 60, 3, 61, 41, 55, 4, 62, 33, 50, 42, 56, 20, 36, 5, 63, 53, 31, 34, 51, 13, 15, 43, 57, 17, 28, 21, 37, 24, 45, 6, 64, 59, 40, 54, 32, 49, 19, 35, 52, 30, 12, 14, 16, 27, 23, 44, 58, 39, 48, 18, 29, 11, 26, 22, 38, 47, 10, 25, 46, 9, 8, 7};
+
+			/**
+			* @brief 最上位ビット以下を1で埋める
+			* @param x 最上位ビットを検出したい整数値
+			* @return 最上位ビット以下が１で埋められた値
+			*/
+			SPOOK_CONSTEVAL auto fill_msb_less_one(std::uint64_t x) -> std::uint64_t {
+				x |= (x >> 1);
+				x |= (x >> 2);
+				x |= (x >> 4);
+				x |= (x >> 8);
+				x |= (x >> 16);
+				x |= (x >> 32);
+
+				return x;
+			}
+
+			/**
+			* @brief 実行時にCPUのビット命令（lzcnt/tzcnt/popcnt等）を使える型か
+			* @detail 標準の符号なし整数型のみ、<bit>かGCC/Clangの組み込み関数が使える時
+			*/
+			template<typename T>
+			inline constexpr bool has_bit_intrinsic =
+#if defined(__cpp_lib_bitops) || defined(__GNUC__)
+				std::disjunction_v<
+					std::is_same<T, unsigned char>,
+					std::is_same<T, unsigned short>,
+					std::is_same<T, unsigned int>,
+					std::is_same<T, unsigned long>,
+					std::is_same<T, unsigned long long>
+				>;
+#else
+				false;
+#endif
+
+#if defined(__cpp_lib_bitops)
+
+			/**
+			* @brief 上位から連続する0の数、x != 0であること
+			*/
+			template<typename T>
+			constexpr auto intrinsic_countl_zero(T x) -> int {
+				return std::countl_zero(x);
+			}
+
+			/**
+			* @brief 下位から連続する0の数、x != 0であること
+			*/
+			template<typename T>
+			constexpr auto intrinsic_countr_zero(T x) -> int {
+				return std::countr_zero(x);
+			}
+
+			template<typename T>
+			constexpr auto intrinsic_popcount(T x) -> int {
+				return std::popcount(x);
+			}
+
+#elif defined(__GNUC__)
+
+			template<typename T>
+			constexpr auto intrinsic_countl_zero(T x) -> int {
+				return __builtin_clzll(x) - int((sizeof(unsigned long long) - sizeof(T)) * CHAR_BIT);
+			}
+
+			template<typename T>
+			constexpr auto intrinsic_countr_zero(T x) -> int {
+				return __builtin_ctzll(x);
+			}
+
+			template<typename T>
+			constexpr auto intrinsic_popcount(T x) -> int {
+				return __builtin_popcountll(x);
+			}
+
+#else
+
+			template<typename T>
+			auto intrinsic_countl_zero(T x) -> int = delete;
+
+			template<typename T>
+			auto intrinsic_countr_zero(T x) -> int = delete;
+
+			template<typename T>
+			auto intrinsic_popcount(T x) -> int = delete;
+
+#endif // __cpp_lib_bitops
+
+		} // namespace detail
+
+		/**
+		* @brief 右端を1桁目として、最上位ビットの位置を求める
+		* @param x LSB位置を求める値
+		* @return LSBの位置（x == 0なら0）
+		*/
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto msb_pos(T x) -> int {
+			if (x == T(0)) return 0;
+
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return int(sizeof(T) * CHAR_BIT) - detail::intrinsic_countl_zero(x);
+			}
+
+			//最上位ビットだけを残す
+			T v = T(detail::fill_msb_less_one(std::uint64_t(x)));
+			v = v ^ (v >> 1);
+
+			int h = detail::hash_64(v);
+
+			return detail::hash2pos[h];
+		}
+
+		/**
+		* @brief 右端を1桁目として、最下位ビットの位置を求める
+		* @param x MSB位置を求める値
+		* @return MSBの位置（x == 0なら0）
+		*/
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto lsb_pos(T x) -> int
+		{
+			if (x == T(0)) return 0;
+
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return detail::intrinsic_countr_zero(x) + 1;
+			}
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4146)
+#endif				  // MSC_VER
+			T v = x & -x; //最下位ビットだけを残す
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif // MSC_VER
+
+			int h = detail::hash_64(v);
+
+			return detail::hash2pos[h];
+		}
+
+		namespace detail {
+
+			SPOOK_CONSTEVAL auto popcount_impl(std::uint64_t x) -> int {
+				using int_t = std::uint64_t;
+				int_t t = ((x & int_t(0xAAAAAAAAAAAAAAAAull)) >> 1) + (x & int_t(0x5555555555555555ull));
+				t = ((t & int_t(0xCCCCCCCCCCCCCCCCull)) >> 2) + (t & int_t(0x3333333333333333ull));
+				t = ((t & int_t(0xF0F0F0F0F0F0F0F0ull)) >> 4) + (t & int_t(0x0F0F0F0F0F0F0F0Full));
+				t = ((t & int_t(0xFF00FF00FF00FF00ull)) >> 8) + (t & int_t(0x00FF00FF00FF00FFull));
+				t = ((t & int_t(0xFFFF0000FFFF0000ull)) >> 16) + (t & int_t(0x0000FFFF0000FFFFull));
+				t = ((t & int_t(0xFFFFFFFF00000000ull)) >> 32) + (t & int_t(0x00000000FFFFFFFFull));
+
+				return int(t);
+			}
+
+			template<typename T>
+			SPOOK_CONSTEVAL auto popcount_impl(T x) -> int {
+				int count{};
+
+				while (x != T(0))
+				{
+					count += T(1) & x;
+					x >>= 1;
+				}
+
+				return count;
+			}
+		}
+
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto is_pow2(T x) -> bool {
+			return x && !(x & (x - 1));
+		}
+
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto popcount(T x) -> int {
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return detail::intrinsic_popcount(x);
+			}
+
+			if constexpr (spook::is_pow2(sizeof(T))) {
+				return detail::popcount_impl(std::uint64_t(x));
+			}
+			else {
+				return detail::popcount_impl(x);
+			}
+		}
+
+		namespace detail {
+			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint8_t x) -> std::uint8_t {
+				using int_t = std::uint8_t;
+				int_t t = (x  >> 4) | (x  << 4);
+				t = ((t & int_t(0xCCu)) >> 2) | ((t & int_t(0x33u)) << 2);
+				t = ((t & int_t(0xAAu)) >> 1) | ((t & int_t(0x55u)) << 1);
+
+				return t;
+			}
+
+			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint16_t x) -> std::uint16_t {
+				using int_t = std::uint16_t;
+				int_t t = (x >> 8) | (x << 8);
+				t = ((t & int_t(0xF0F0u)) >> 4) | ((t & int_t(0x0F0Fu)) << 4);
+				t = ((t & int_t(0xCCCCu)) >> 2) | ((t & int_t(0x3333u)) << 2);
+				t = ((t & int_t(0xAAAAu)) >> 1) | ((t & int_t(0x5555u)) << 1);
+
+				return t;
+			}
+
+			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint32_t x) -> std::uint32_t {
+				using int_t = std::uint32_t;
+				int_t t = (x >> 16) | (x << 16);
+				t = ((t & int_t(0xFF00FF00u)) >> 8) | ((t & int_t(0x00FF00FFu)) << 8);
+				t = ((t & int_t(0xF0F0F0F0u)) >> 4) | ((t & int_t(0x0F0F0F0Fu)) << 4);
+				t = ((t & int_t(0xCCCCCCCCu)) >> 2) | ((t & int_t(0x33333333u)) << 2);
+				t = ((t & int_t(0xAAAAAAAAu)) >> 1) | ((t & int_t(0x55555555u)) << 1);
+
+				return t;
+			}
+
+			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint64_t x) -> std::uint64_t {
+				//最大桁の半分から再帰的に半分づつ入れ替えていく
+
+				using int_t = std::uint64_t;
+				int_t t = (x >> 32) | (x << 32);
+				t = ((t & int_t(0xFFFF0000FFFF0000u)) >> 16) | ((t & int_t(0x0000FFFF0000FFFFu)) << 16);
+				t = ((t & int_t(0xFF00FF00FF00FF00u)) >> 8 ) | ((t & int_t(0x00FF00FF00FF00FFu)) << 8);
+				t = ((t & int_t(0xF0F0F0F0F0F0F0F0u)) >> 4 ) | ((t & int_t(0x0F0F0F0F0F0F0F0Fu)) << 4);
+				t = ((t & int_t(0xCCCCCCCCCCCCCCCCu)) >> 2 ) | ((t & int_t(0x3333333333333333u)) << 2);
+				t = ((t & int_t(0xAAAAAAAAAAAAAAAAu)) >> 1 ) | ((t & int_t(0x5555555555555555u)) << 1);
+
+				return t;
+			}
+
+			template <typename T>
+			SPOOK_CONSTEVAL auto bit_reverse_impl(T x) = delete;
+		} // namespace detail
+
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto bit_reverse(T x) -> T {
+			//各型用の二分再帰による実装に移譲
+			return detail::bit_reverse_impl(x);
+		}
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto rotl(T x, int s) -> T;
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto rotr(T x, int s) -> T {
+			constexpr auto N = sizeof(T) * CHAR_BIT;
+			const int r = s % N;
+
+			if (r == 0) return x;
+			if (r < 0) return rotl(x, -r);
+			return (x >> r) | (x << (N - r));
+		}
+
+		template<typename T CONCEPT_FALLBACK_REDECL(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto rotl(T x, int s) -> T {
+			constexpr auto N = sizeof(T) * CHAR_BIT;
+			const int r = s % N;
+
+			if (r == 0) return x;
+			if (r < 0) return rotr(x, -r);
+			return (x << r) | (x >> (N - r));
+		}
+
+		template<typename T CONCEPT_FALLBACK_REDECL(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto countr_zero(T x) -> int {
+			if (x == 0) return sizeof(T) * CHAR_BIT;
+
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return detail::intrinsic_countr_zero(x);
+			}
+
+			int n = spook::lsb_pos(x);
+			return --n;
+		}
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto countr_one(T x) -> int {
+			if (x == 0) return 0;
+
+			return spook::countr_zero(T(~x));
+		}
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto countl_zero(T x) -> int {
+			if (x == 0) return sizeof(T) * CHAR_BIT;
+
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return detail::intrinsic_countl_zero(x);
+			}
+
+			auto n = spook::msb_pos(x);
+			return (sizeof(T) * CHAR_BIT) - n;
+		}
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto countl_one(T x) -> int{
+			if (x == 0) return 0;
+			return spook::countl_zero(T(~x));
+		}
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto ceil2(T x) -> T {
+			if (x == T(0)) return T(1);
+
+			//丁度2^Nの値を正しく出力するために1引いておく
+			--x;
+
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) {
+					if (x == T(0)) return T(1);
+
+					//2^N <= xの場合は下と同じく0になる
+					const int n = int(sizeof(T) * CHAR_BIT) - detail::intrinsic_countl_zero(x);
+					return (n == int(sizeof(T) * CHAR_BIT)) ? T(0) : T(T(1) << n);
+				}
+			}
+
+			T v = T(detail::fill_msb_less_one(std::uint64_t(x)));
+			//帰ってきた値が全て１で埋まっていた場合（TのビットをNとすると2^N <= xの場合）、結果は正しくない
+			return ++v;
+		}
+
+		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto floor2(T x) -> T {
+			if (x == T(0)) return T(0);
+
+			if constexpr (detail::has_bit_intrinsic<T>) {
+				if (!SPOOK_IS_CONSTANT_EVALUATED()) return T(T(1) << (int(sizeof(T) * CHAR_BIT) - 1 - detail::intrinsic_countl_zero(x)));
+			}
+
+			T v = T(detail::fill_msb_less_one(std::uint64_t(x)));
+			return v ^ (v >> 1);	//最上位ビットだけを残す
+		}
+
+		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
+		SPOOK_CONSTEVAL auto log2p1(T x) -> T {
+			//log2p1はすなわち最上位ビットの位置！
+			return T(spook::msb_pos(x));
+		}
+
+		template<typename R = std::uint64_t CONCEPT_FALLBACK(spook::unsigned_integral<R, enabler<is_unsigned<R>>)>
+		SPOOK_CONSTEVAL auto pow2(unsigned int n) -> R {
+			return R(1) << n;
+		}
+	}
+
+	inline namespace fourier {
+
+		namespace detail {
+
+			/**
+			* @brief nの最小の素因数（n >= 2）
+			*/
+			SPOOK_CONSTEVAL auto smallest_factor(std::size_t n) -> std::size_t {
+				for (std::size_t p = 2; p * p <= n; ++p) {
+					if (n % p == 0) return p;
+				}
+				return n;
+			}
+
+			/**
+			* @brief exp(-2πi k / N)
+			* @detail 角度を八分円[0, π/4]に還元してから計算し、対称性で戻す。1、-1、±iやcosとsinの対称な組は正確に一致する
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto twiddle(std::size_t k) -> std::complex<T> {
+				using W = table::detail::direct_t<T>;
+
+				//2πk/N = qπ/2 + (π/2)(j/N)
+				const std::size_t quadrant = (4 * k) / N;
+				const std::size_t j = 4 * k - quadrant * N;
+				const bool upper = N < 2 * j;
+
+				const W phi = constant::pi<W> / W(2.0) * W(upper ? N - j : j) / W(N);
+				const std::complex<W> base = spook::polar(W(1.0), phi);
+				const W c = upper ? base.imag() : base.real();
+				const W s = upper ? base.real() : base.imag();
+
+				//exp(-iθ)なので虚部は-sin(θ)
+				switch (quadrant) {
+				case 0:  return { T( c), T(-s) };
+				case 1:  return { T(-s), T(-c) };
+				case 2:  return { T(-c), T( s) };
+				default: return { T( s), T( c) };
+				}
+			}
+
+			template<typename T, std::size_t N>
+			SPOOK_CONSTEVAL auto make_twiddles() -> std::array<std::complex<T>, N> {
+				std::array<std::complex<T>, N> w{};
+				for (std::size_t k = 0; k < N; ++k) w[k] = detail::twiddle<T, N>(k);
+				return w;
+			}
+
+			/**
+			* @brief 回転因子exp(-2πi k / N)（k = 0, ..., N-1）の表、コンパイル時に作られる
+			*/
+			template<typename T, std::size_t N>
+			inline constexpr std::array<std::complex<T>, N> twiddles = detail::make_twiddles<T, N>();
+
+			template<std::size_t N>
+			SPOOK_CONSTEVAL auto make_bit_reversal() -> std::array<std::size_t, N> {
+				std::array<std::size_t, N> r{};
+				constexpr int shift = 64 - spook::countr_zero(std::uint64_t(N));
+
+				for (std::size_t i = 0; i < N; ++i) {
+					r[i] = (N < 2) ? i : std::size_t(spook::bit_reverse(std::uint64_t(i)) >> shift);
+				}
+				return r;
+			}
+
+			/**
+			* @brief ビット反転の並べ替え表（Nは2の冪）、コンパイル時に作られる
+			*/
+			template<std::size_t N>
+			inline constexpr std::array<std::size_t, N> bit_reversal = detail::make_bit_reversal<N>();
+
+			/**
+			* @brief a * w、Inverseならa * conj(w)
+			* @detail std::complexの乗算は実行時にNaNの検査を伴うので、実部と虚部で直接計算する
+			*/
+			template<bool Inverse, typename T>
+			SPOOK_FORCE_INLINE constexpr auto rotate(const std::complex<T>& a, const std::complex<T>& w) -> std::complex<T> {
+				const T wi = Inverse ? -w.imag() : w.imag();
+				return { a.real() * w.real() - a.imag() * wi, a.real() * wi + a.imag() * w.real() };
+			}
+
+			/**
+			* @brief 2の冪の長さの基数2、時間間引きのFFT
+			* @detail 入力をビット反転の順に並べ替えてから、その場でバタフライ演算を行う
+			*/
+			template<bool Inverse, typename T, std::size_t N>
+			constexpr void radix2(std::array<std::complex<T>, N>& x) {
+				const auto& rev = detail::bit_reversal<N>;
+				const auto& w = detail::twiddles<T, N>;
+
+				for (std::size_t i = 0; i < N; ++i) {
+					if (i < rev[i]) {
+						const std::complex<T> t = x[i];
+						x[i] = x[rev[i]];
+						x[rev[i]] = t;
+					}
+				}
+
+				for (std::size_t half = 1; half < N; half *= 2) {
+					const std::size_t step = N / (2 * half);
+
+					for (std::size_t first = 0; first < N; first += 2 * half) {
+						for (std::size_t k = 0; k < half; ++k) {
+							const std::complex<T> u = x[first + k];
+							const std::complex<T> v = detail::rotate<Inverse>(x[first + k + half], w[k * step]);
+
+							x[first + k] = { u.real() + v.real(), u.imag() + v.imag() };
+							x[first + k + half] = { u.real() - v.real(), u.imag() - v.imag() };
+						}
+					}
+				}
+			}
+
+			/**
+			* @brief 任意の長さの混合基数、周波数間引きのFFT（Stockhamの自動整列）
+			* @detail Nの素因数pごとに長さpのDFTを行い、作業領域と交互に読み書きするので並べ替えが要らない
+			*         pが大きい素数の時はO(p^2)の直接計算になる
+			*/
+			template<bool Inverse, typename T, std::size_t N>
+			constexpr void mixed_radix(std::array<std::complex<T>, N>& x) {
+				const auto& w = detail::twiddles<T, N>;
+
+				std::array<std::complex<T>, N> buffer{};
+				std::complex<T>* src = x.data();
+				std::complex<T>* dst = buffer.data();
+
+				//n: 残りの長さ、s: 処理済みの因数の積
+				for (std::size_t n = N, s = 1; 1 < n;) {
+					const std::size_t p = detail::smallest_factor(n);
+					const std::size_t m = n / p;
+
+					for (std::size_t j = 0; j < m; ++j) {
+						for (std::size_t k = 0; k < p; ++k) {
+							//長さpのDFTの回転因子はexp(-2πi rk / p) = w[(N / p) rk mod N]、続けてexp(-2πi jk / n) = w[jks]を掛ける
+							const std::complex<T> outer = w[(j * k * s) % N];
+
+							for (std::size_t q = 0; q < s; ++q) {
+								T re{}, im{};
+								for (std::size_t r = 0; r < p; ++r) {
+									const std::complex<T> v = detail::rotate<Inverse>(src[q + s * (j + r * m)], w[((N / p) * r * k) % N]);
+									re += v.real();
+									im += v.imag();
+								}
+								dst[q + s * (p * j + k)] = detail::rotate<Inverse>(std::complex<T>(re, im), outer);
+							}
+						}
+					}
+
+					std::complex<T>* t = src;
+					src = dst;
+					dst = t;
+					n = m;
+					s *= p;
+				}
+
+				if (src != x.data()) {
+					for (std::size_t i = 0; i < N; ++i) x[i] = src[i];
+				}
+			}
+
+			template<bool Inverse, typename T, std::size_t N>
+			constexpr void transform(std::array<std::complex<T>, N>& x) {
+				if constexpr (N < 2) {
+					return;
+				} else if constexpr (spook::is_pow2(N)) {
+					detail::radix2<Inverse>(x);
+				} else {
+					detail::mixed_radix<Inverse>(x);
+				}
+			}
+		}
+
+		/**
+		* @brief 離散フーリエ変換 X_k = Σ x_n exp(-2πi kn / N)
+		* @detail Nが2の冪なら基数2、それ以外は混合基数で計算する。回転因子とビット反転の表はコンパイル時に作られる
+		* @detail 定数式でも使える
+		* @param x 入力
+		* @return 変換結果
+		*/
+		template<typename T, std::size_t N CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto fft(std::array<std::complex<T>, N> x) -> std::array<std::complex<T>, N> {
+			detail::transform<false>(x);
+			return x;
+		}
+
+		/**
+		* @brief 逆離散フーリエ変換 x_n = (1/N) Σ X_k exp(2πi kn / N)
+		* @detail spook::ifft(spook::fft(x))はxに（丸め誤差を除いて）戻る
+		*/
+		template<typename T, std::size_t N CONCEPT_FALLBACK(spook::floating_point<T, enabler<spook::is_floating_point<T>>)>
+		SPOOK_CONSTEVAL auto ifft(std::array<std::complex<T>, N> x) -> std::array<std::complex<T>, N> {
+			detail::transform<true>(x);
+
+			for (auto& v : x) v = { v.real() / T(N), v.imag() / T(N) };
+			return x;
+		}
+	}
+
+	inline namespace functional {
+
+		namespace detail {
+
+			template<typename T>
+			struct is_reference_wrapper : std::false_type {};
+			
+			template<typename T>
+			struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type {};
+
+			template<typename T>
+			inline constexpr bool is_reference_wrapper_v = detail::is_reference_wrapper<T>::value;
+
+			template<typename F, typename T, typename... Args>
+			SPOOK_CONSTEVAL decltype(auto) invoke_memfn(F&& f, T&& t1, Args&&... args) {
+				using prime_t = std::remove_cvref_t<decltype(t1)>;
+
+				if constexpr (std::is_base_of_v<type_traits::memberptr_to_t<F>, prime_t>) {
+					return (std::forward<T>(t1).*f)(std::forward<Args>(args)...);
+				}
+				else if constexpr (detail::is_reference_wrapper_v<prime_t>) {
+					return (std::forward<T>(t1).get().*f)(std::forward<Args>(args)...);
+				} else {
+					return ((*std::forward<T>(t1)).*f)(std::forward<Args>(args)...);
+				}
+			}
+
+			template <typename F, typename T>
+			SPOOK_CONSTEVAL decltype(auto) invoke_memobj(F&& f, T&& t1) {
+				using prime_t = std::remove_cvref_t<decltype(t1)>;
+
+				if constexpr (std::is_base_of_v<type_traits::memberptr_to_t<F>, prime_t>) {
+					return std::forward<T>(t1).*f;
+				} else if constexpr (detail::is_reference_wrapper_v<prime_t>) {
+					return std::forward<T>(t1).get().*f;
+				} else {
+					return (*std::forward<T>(t1)).*f;
+				}
+			}
+		}
+
+		template<typename F, typename... Args>
+		SPOOK_CONSTEVAL auto invoke(F&& f, Args&&... args) -> std::invoke_result_t<F, Args...> {
+			using prime_t = std::remove_cvref_t<F>;
+
+			if constexpr (std::is_member_function_pointer_v<prime_t>) {
+				//メンバポインタ呼び出し
+				return detail::invoke_memfn(std::forward<F>(f), std::forward<Args>(args)...);
+			} else if constexpr (sizeof...(Args) == 1 && std::is_member_object_pointer_v<prime_t>) {
+				//メンバオブジェクト呼び出し
+				return detail::invoke_memobj(std::forward<F>(f), std::forward<Args>(args)...);
+			} else {
+				//その他関数呼び出し
+				return std::forward<F>(f)(std::forward<Args>(args)...);
+			}
+		}
+	}
+
+	inline namespace tuple {
+
+		namespace detail {
+			template <typename F, typename Tuple, std::size_t... Index>
+			SPOOK_CONSTEVAL decltype(auto) apply_impl(F&& f, Tuple&& t, std::index_sequence<Index...>) {
+				return spook::invoke(std::forward<F>(f), std::get<Index>(std::forward<Tuple>(t))...);
+			}
+
+			template <typename T, typename Tuple, std::size_t... Index>
+			SPOOK_CONSTEVAL auto make_from_tuple_impl(Tuple&& t, std::index_sequence<Index...>) -> T {
+				return T(std::get<Index>(std::forward<Tuple>(t))...);
+			}
+		}
+
+		template<typename F, typename Tuple>
+		SPOOK_CONSTEVAL auto apply(F&& f, Tuple&& t) -> decltype(std::apply(std::declval<F&>(), std::declval<Tuple&>())) {
+			using prime_tuple_t = std::remove_reference_t<Tuple>;
+			
+			return detail::apply_impl(std::forward<F>(f), std::forward<Tuple>(t), std::make_index_sequence<std::tuple_size_v<prime_tuple_t>>{});
+		}
+
+		template<typename T, typename Tuple>
+		SPOOK_CONSTEVAL auto make_from_tuple(Tuple&& t) -> T {
+			using prime_tuple_t = std::remove_reference_t<Tuple>;
+
+			return detail::make_from_tuple_impl<T>(std::forward<Tuple>(t), std::make_index_sequence<std::tuple_size_v<prime_tuple_t>>{});
+		}
+	}
+
+	//ベクトル化の単位
+	namespace batch {
+
+		namespace detail {
+
+			//コンパイル時の対象命令セットにおける、ベクトルレジスタのバイト数
+			inline constexpr std::size_t vector_bytes =
+#if defined(__AVX512F__)
+				64;
+#elif defined(__AVX__)
+				32;
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON)
+				16;
+#else
+				8;
+#endif
+		}
+
+		/**
+		* @brief ベクトルレジスタ1本で同時に処理できるTの要素数
+		*/
+		template<typename T>
+		inline constexpr std::size_t simd_width = (sizeof(T) < detail::vector_bytes) ? detail::vector_bytes / sizeof(T) : 1;
+	}
+
+#ifdef __cpp_lib_bit_cast
+
+	namespace batch {
+		namespace detail {
+
+			template<typename T>
+			inline constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+			/**
+			* @brief 分岐の無い処理で使う、浮動小数点数のビット列と整数の相互変換
+			* @detail float <-> intの変換は範囲外の値で未定義動作となるうえ、命令セットによってはベクトル化されないので、
+			* @detail 仮数部の桁数に合わせた定数magic = 1.5 * 2^(digits - 1)を足した時の仮数部の下位ビットを整数として使う
+			*/
+			template<typename T>
+			struct lane_bits {
+				using layout = cmath::detail::float_layout<T>;
+				using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+				static constexpr int digits = std::numeric_limits<T>::digits;
+				static constexpr T magic = T(1.5) * cmath::detail::scale2(T(1.0), digits - 1);
+
+				static auto to_bits(T x) -> bits_t {
+					return std::bit_cast<bits_t>(x);
+				}
+
+				static auto from_bits(bits_t b) -> T {
+					return std::bit_cast<T>(b);
+				}
 
-				R m = std::max(abs_m, abs_n);
-				R n = std::min(abs_m, abs_n);
+				/**
+				* @brief 0方向へ丸める（|s| < 2^(digits - 2)の時のstatic_cast<int>(s)と同じ値）
+				*/
+				static auto trunc(T s) -> T {
+					//絶対値を最も近い整数へ丸めてから、大きくなっていれば戻す
+					const T a = std::fabs(s);
+					const T r = (a + magic) - magic;
+					const bits_t mask = bits_t(0) - bits_t(a < r);
+					return std::copysign(r - from_bits(to_bits(T(1.0)) & mask), s);
+				}
 
-				//オーバーフロー対策に大きい方を先に割る
-				return R((m / detail::gcd_impl(m, n, std::forward<Mod>(mod))) * n);
+				/**
+				* @brief 整数値rを、2の補数表現の整数にする
+				*/
+				static auto to_int(T r) -> bits_t {
+					return to_bits(r + magic) - to_bits(magic);
+				}
+
+				/**
+				* @brief 2の補数表現の整数nを、浮動小数点数にする（|n| < 2^(digits - 2)）
+				*/
+				static auto from_int(bits_t n) -> T {
+					return from_bits(to_bits(magic) + n) - magic;
+				}
+
+				/**
+				* @brief 2^n、nは正規化数の指数の範囲であること
+				*/
+				static auto pow2(bits_t n) -> T {
+					return from_bits((n + bits_t(layout::bias)) << layout::mantissa_bits);
+				}
+
+				/**
+				* @brief 下位ビットが立っている時はb、そうでなければaを選ぶ
+				*/
+				static auto select(bits_t flag, T a, T b) -> T {
+					const bits_t mask = bits_t(0) - (flag & 1u);
+					return from_bits((to_bits(b) & mask) | (to_bits(a) & ~mask));
+				}
+
+				/**
+				* @brief c ? if_true : if_falseと同じ
+				* @detail 片方の値でしか使わない計算を分岐に戻されないように、ビット演算で選ぶ
+				*/
+				static auto blend(bool c, T if_true, T if_false) -> T {
+					return select(bits_t(c), if_false, if_true);
+				}
+
+				/**
+				* @brief acceptが偽ならNaNにする
+				* @detail 定数を選ぶ条件演算子はコンパイラが分岐に戻してしまうことがあるので、ビット演算で行う
+				*/
+				static auto nan_unless(bool accept, T x) -> T {
+					const bits_t mask = bits_t(accept) - 1u;
+					return from_bits(to_bits(x) | (to_bits(nan<T>) & mask));
+				}
+
+				/**
+				* @brief flagの下位ビットが立っている時は符号を反転する
+				*/
+				static auto negate_if(bits_t flag, T x) -> T {
+					return from_bits(to_bits(x) ^ ((flag & 1u) << (sizeof(T) * CHAR_BIT - 1)));
+				}
+			};
+
+			/**
+			* @brief sin(theta)（cosine == trueならcos(theta)）
+			* @detail spook::sinと同じくCody-Waiteで還元する（|theta| <= pi/4では商が0となり、還元しないのと同じ値になる）
+			* @return 還元の難しい大きな値と∞、NaNはNaN
+			*/
+			template<typename T>
+			SPOOK_FORCE_INLINE auto sin_lane(T theta, bool cosine) -> T {
+				namespace cd = cmath::detail;
+				using cw = cd::cody_waite_pi_over_2<T>;
+				using lb = lane_bits<T>;
+
+				const bool negative = theta < T(0.0);
+				const T x = std::fabs(theta);
+				const T fn = lb::trunc(x * cw::two_over_pi + T(0.5));
+				const auto [r_hi, r_lo] = cd::cody_waite_remainder(x, fn);
+
+				const typename lb::bits_t n = lb::to_int(fn);
+				const T hi = lb::negate_if(negative, r_hi);
+				const T lo = lb::negate_if(negative, r_lo);
+				const auto quadrant = (negative ? 4u - (n & 3u) : n & 3u) + (cosine ? 1u : 0u);
+
+				//cos(x) = sin(x + pi/2)
+				const T v = lb::select(quadrant, cd::sin_kernel(hi, lo), cd::cos_kernel(hi, lo));
+				const T r = lb::negate_if(quadrant >> 1, v);
+
+				if (cosine) return lb::nan_unless(x * cw::two_over_pi < cw::bound, r);
+				return lb::nan_unless(x * cw::two_over_pi < cw::bound, lb::blend(theta == T(0.0), theta, r));
 			}
-		}
-	}
 
-	inline namespace bit {
+			/**
+			* @brief exp(hi + lo)
+			* @detail spook::exp_sumと同じ還元と多項式で計算する
+			* @return 結果が正規化数にならない範囲はNaN
+			*/
+			template<typename T>
+			SPOOK_FORCE_INLINE auto exp_lane(T hi, T lo) -> T {
+				namespace cd = cmath::detail;
+				using limits = std::numeric_limits<T>;
+				using lb = lane_bits<T>;
 
-		namespace detail {
+				const T t = hi * cd::exp_constants<T>::log2_e;
+
+				//nearest_intと同じく、0から遠い方へ丸める
+				const T fk = lb::trunc(t + std::copysign(T(0.5), t));
+				const auto [r_hi, r_lo] = cd::ln2_remainder(hi, fk);
+				const auto [s_hi, s_lo] = cd::fast_two_sum(r_hi, r_lo + lo);
+				const T v = cd::add_parts(T(1.0), cd::expm1_kernel(s_hi, s_lo));
+
+				//2^kもv * 2^kも正規化数なので、ldexpと同じ結果になる
+				const T r = v * lb::pow2(lb::to_int(fk));
+
+				return lb::nan_unless((T(limits::min_exponent) <= t) & (t <= T(limits::max_exponent - 2)), r);
+			}
 
 			/**
-			* @brief 任意の64ビット値を0~63の間に押し込めるハッシュ関数
-			* @detail 1ビットだけ立っている値に対しては完全ハッシュとなる、その出力は下のhash2posによってその桁位置に写すことができる
-			* @detail 詳細？http://supertech.csail.mit.edu/papers/debruijn.pdf
-			* @param x 入力
-			* @return [0, 63]の間の値
+			* @brief 正規化数xについて、log(x)を上位と下位の2つの値で計算する
+			* @detail spook::log_partsと同じ還元と多項式で計算する
 			*/
-			SPOOK_CONSTEVAL auto hash_64(std::uint64_t x) -> int {
-				int h = (x * 0x03F566ED27179461UL) >> 58;
-				return h;
+			template<typename T>
+			SPOOK_FORCE_INLINE auto log_parts_lane(T x) -> std::pair<T, T> {
+				namespace cd = cmath::detail;
+				using c = cd::exp_constants<T>;
+				using lb = lane_bits<T>;
+				using layout = typename lb::layout;
+
+				//frexpと同じく[0.5, 1)の仮数にしてから、[sqrt(2)/2, sqrt(2))へ
+				const auto e = ((lb::to_bits(x) & layout::exponent_mask) >> layout::mantissa_bits) - typename lb::bits_t(layout::bias - 1);
+				const T f = lb::from_bits((lb::to_bits(x) & ~layout::exponent_mask) | (typename lb::bits_t(layout::bias - 1) << layout::mantissa_bits));
+
+				const bool low = f < T(0.5) * cd::log_constants<T>::sqrt2;
+				const T m = lb::blend(low, f * T(2.0), f);
+				const T fk = lb::from_int(e) - lb::blend(low, T(1.0), T(0.0));
+
+				//log_reducedのk == 0とそれ以外の場合を両方計算して選ぶ
+				const auto [hi, lo] = cd::log1p_kernel(m - T(1.0));
+				const auto [z_hi, z_lo] = cd::fast_two_sum(hi, lo);
+				const auto [s, err] = cd::fast_two_sum(fk * c::ln2_hi, hi);
+				const auto [k_hi, k_lo] = cd::fast_two_sum(s, err + (lo + fk * c::ln2_lo));
+
+				return { lb::blend(fk == T(0.0), z_hi, k_hi), lb::blend(fk == T(0.0), z_lo, k_lo) };
+			}
+
+			template<typename T>
+			SPOOK_FORCE_INLINE auto is_normal_positive(T x) -> bool {
+				return ((std::numeric_limits<T>::min)() <= x) & (x <= (std::numeric_limits<T>::max)());
+			}
+
+			template<typename T>
+			SPOOK_FORCE_INLINE auto is_finite(T x) -> bool {
+				return (-(std::numeric_limits<T>::max)() <= x) & (x <= (std::numeric_limits<T>::max)());
 			}
 
 			/**
-			* @brief hash_64()の出力を対応する桁位置へ変換
-			* @detail 求める簡易なもの -> https://wandbox.org/permlink/DKLoL1qKgiwTrugE
+			* @brief log(x)
+			* @return 正規化数以外はNaN
 			*/
-			inline constexpr char hash2pos[] = {1, 2, 60, 3, 61, 41, 55, 4, 62, 33, 50, 42, 56, 20, 36, 5, 63, 53, 31, 34, 51, 13, 15, 43, 57, 17, 28, 21, 37, 24, 45, 6, 64, 59, 40, 54, 32, 49, 19, 35, 52, 30, 12, 14, 16, 27, 23, 44, 58, 39, 48, 18, 29, 11, 26, 22, 38, 47, 10, 25, 46, 9, 8, 7};
+			template<typename T>
+			SPOOK_FORCE_INLINE auto log_lane(T x) -> T {
+				const auto [hi, lo] = detail::log_parts_lane(x);
+				return lane_bits<T>::nan_unless(detail::is_normal_positive(x), hi + lo);
+			}
 
 			/**
-			* @brief 最上位ビット以下を1で埋める
-			* @param x 最上位ビットを検出したい整数値
-			* @return 最上位ビット以下が１で埋められた値
+			* @brief pow(b, e)
+			* @detail spook::powと同じく、log(b)を2つの値で持ってexp(e * log(b))を計算する
+			* @return bが正規化数でeが有限の時以外と、結果が正規化数にならない時はNaN
 			*/
-			SPOOK_CONSTEVAL auto fill_msb_less_one(std::uint64_t x) -> std::uint64_t {
-				x |= (x >> 1);
-				x |= (x >> 2);
-				x |= (x >> 4);
-				x |= (x >> 8);
-				x |= (x >> 16);
-				x |= (x >> 32);
+			template<typename T>
+			SPOOK_FORCE_INLINE auto pow_lane(T b, T e) -> T {
+				const auto [log_hi, log_lo] = detail::log_parts_lane(b);
+				const auto [p, pe] = cmath::detail::two_prod(e, log_hi);
+				const T r = detail::exp_lane(p, pe + e * log_lo);
 
-				return x;
+				return lane_bits<T>::nan_unless(detail::is_normal_positive(b) & detail::is_finite(e), r);
 			}
 
-		} // namespace detail
+			/**
+			* @brief 点(x, y)の偏角
+			* @detail spook::atan2と同じく、小さい方を大きい方で割ってatan_ratioの3つの場合を全て計算して選ぶ
+			* @return 0と∞とNaN、大きさを揃える必要のある極端な値はNaN
+			*/
+			template<typename T>
+			SPOOK_FORCE_INLINE auto atan2_lane(T y, T x) -> T {
+				namespace cd = cmath::detail;
+				using c = cd::atan_constants<T>;
+				using lb = lane_bits<T>;
+
+				const T ay = std::fabs(y);
+				const T ax = std::fabs(x);
+
+				const bool swap = !(ay <= ax);
+				const T n = lb::blend(swap, ax, ay);
+				const T d = lb::blend(swap, ay, ax);
+
+				const T q = n / d;
+				const auto direct = cd::atan_ratio_direct(n, T(0.0), d, T(0.0));
+				const auto shifted = cd::atan_ratio_shifted(n, T(0.0), d, T(0.0));
+				const bool tiny = q < c::tiny;
+				const bool near = q <= c::tan_pi_8;
+
+				const T k_hi = lb::blend(tiny, q, lb::blend(near, direct.first, shifted.first));
+				const T k_lo = lb::blend(tiny, (T(0.0) - q * T(0.0)) / d, lb::blend(near, direct.second, shifted.second));
+
+				const auto h = cd::half_pi_minus(std::pair<T, T>{ k_hi, k_lo });
+				const T a_hi = lb::blend(swap, h.first, k_hi);
+				const T a_lo = lb::blend(swap, h.second, k_lo);
+
+				const auto m = cd::pi_minus(std::pair<T, T>{ a_hi, a_lo });
+				const T result = lb::blend(x < T(0.0), m.first + m.second, a_hi + a_lo);
+
+				const bool accept = (T(0.0) < n) & (c::safe_min <= d) & (d <= c::safe_max);
+				return lb::nan_unless(accept, lb::negate_if(y < T(0.0), result));
+			}
+		}
+	}
+
+#endif // __cpp_lib_bit_cast
+
+#if defined(__GNUC__) && defined(__cpp_lib_bit_cast)
+
+	inline namespace vector_extension {
+
+		namespace detail {
+
+			/**
+			* @brief 要素毎の比較結果を持つ、Tと同じ大きさの符号付き整数型
+			*/
+			template<typename T>
+			using mask_element_t = std::conditional_t<sizeof(T) == 1, std::int8_t,
+				std::conditional_t<sizeof(T) == 2, std::int16_t,
+				std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>>>;
+
+			/**
+			* @brief 要素型T、要素数NのGCCのベクトル型
+			*/
+			template<typename T, std::size_t N>
+			struct vector_of {
+				typedef T type __attribute__((vector_size(sizeof(T) * N)));
+			};
+		}
 
 		/**
-		* @brief 右端を1桁目として、最上位ビットの位置を求める
-		* @param x LSB位置を求める値
-		* @return LSBの位置（x == 0なら0）
+		* @brief simdの要素毎の真偽値
+		* @detail 各要素は真なら全ビットが1、偽なら0の整数で、isnan等の分岐の代わりにselectで使う
 		*/
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto msb_pos(T x) -> int {
-			if (x == T(0)) return 0;
-			//最上位ビットだけを残す
-			T v = T(detail::fill_msb_less_one(std::uint64_t(x)));
-			v = v ^ (v >> 1);
+		template<typename T, std::size_t N = batch::simd_width<T>>
+		struct simd_mask {
+			using element_type = detail::mask_element_t<T>;
+			using native_type = typename detail::vector_of<element_type, N>::type;
 
-			int h = detail::hash_64(v);
+			native_type v{};
 
-			return detail::hash2pos[h];
-		}
+			simd_mask() = default;
+
+			simd_mask(native_type m) : v(m) {}
+
+			/**
+			* @brief 全要素をbにする
+			*/
+			explicit simd_mask(bool b) : v(native_type{} - element_type(b)) {}
+
+			static constexpr auto size() -> std::size_t {
+				return N;
+			}
+
+			auto operator[](std::size_t i) const -> bool {
+				return v[i] != 0;
+			}
+
+			friend auto operator!(const simd_mask& a) -> simd_mask {
+				return simd_mask(~a.v);
+			}
+
+			friend auto operator&(const simd_mask& a, const simd_mask& b) -> simd_mask {
+				return simd_mask(a.v & b.v);
+			}
+
+			friend auto operator|(const simd_mask& a, const simd_mask& b) -> simd_mask {
+				return simd_mask(a.v | b.v);
+			}
+
+			friend auto operator^(const simd_mask& a, const simd_mask& b) -> simd_mask {
+				return simd_mask(a.v ^ b.v);
+			}
+		};
 
 		/**
-		* @brief 右端を1桁目として、最下位ビットの位置を求める
-		* @param x MSB位置を求める値
-		* @return MSBの位置（x == 0なら0）
+		* @brief GCCのベクトル拡張による、ベクトルレジスタ1本分の値
+		* @tparam T 要素型、floatとdoubleか符号なし整数型
+		* @tparam N 要素数、sizeof(T) * Nは2の冪であること（既定ではコンパイル時の対象命令セットのレジスタ幅）
+		* @detail 演算は要素毎に行われ、比較の結果はsimd_maskになる
 		*/
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto lsb_pos(T x) -> int
-		{
-			if (x == T(0)) return 0;
+		template<typename T, std::size_t N = batch::simd_width<T>>
+		struct simd {
+			static_assert(spook::is_pow2(sizeof(T) * N), "sizeof(T) * N must be a power of 2.");
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4146)
-#endif				  // MSC_VER
-			T v = x & -x; //最下位ビットだけを残す
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif // MSC_VER
+			using value_type = T;
+			using native_type = typename detail::vector_of<T, N>::type;
+			using mask_type = simd_mask<T, N>;
 
-			int h = detail::hash_64(v);
+			native_type v{};
 
-			return detail::hash2pos[h];
-		}
+			simd() = default;
 
-		namespace detail {
+			simd(native_type x) : v(x) {}
 
-			SPOOK_CONSTEVAL auto popcount_impl(std::uint64_t x) -> int {
-				using int_t = std::uint64_t;
-				int_t t = ((x & int_t(0xAAAAAAAAAAAAAAAAull)) >> 1) + (x & int_t(0x5555555555555555ull));
-				t = ((t & int_t(0xCCCCCCCCCCCCCCCCull)) >> 2) + (t & int_t(0x3333333333333333ull));
-				t = ((t & int_t(0xF0F0F0F0F0F0F0F0ull)) >> 4) + (t & int_t(0x0F0F0F0F0F0F0F0Full));
-				t = ((t & int_t(0xFF00FF00FF00FF00ull)) >> 8) + (t & int_t(0x00FF00FF00FF00FFull));
-				t = ((t & int_t(0xFFFF0000FFFF0000ull)) >> 16) + (t & int_t(0x0000FFFF0000FFFFull));
-				t = ((t & int_t(0xFFFFFFFF00000000ull)) >> 32) + (t & int_t(0x00000000FFFFFFFFull));
+			/**
+			* @brief 全要素をxにする
+			*/
+			simd(T x) : v(native_type{} + x) {}
 
-				return int(t);
+			/**
+			* @brief 連続したN要素を読み込む、境界は揃っていなくてもよい
+			*/
+			static auto load(const T* p) -> simd {
+				simd r;
+				for (std::size_t i = 0; i < N; ++i) r.v[i] = p[i];
+				return r;
 			}
 
-			template<typename T>
-			SPOOK_CONSTEVAL auto popcount_impl(T x) -> int {
-				int count{};
+			/**
+			* @brief 連続したN要素に書き込む、境界は揃っていなくてもよい
+			*/
+			void store(T* p) const {
+				for (std::size_t i = 0; i < N; ++i) p[i] = v[i];
+			}
 
-				while (x != T(0))
-				{
-					count += T(1) & x;
-					x >>= 1;
-				}
+			static constexpr auto size() -> std::size_t {
+				return N;
+			}
 
-				return count;
+			auto operator[](std::size_t i) const -> T {
+				return v[i];
+			}
+
+			friend auto operator+(const simd& a) -> simd {
+				return a;
+			}
+
+			friend auto operator-(const simd& a) -> simd {
+				return simd(-a.v);
+			}
+
+			friend auto operator+(const simd& a, const simd& b) -> simd {
+				return simd(a.v + b.v);
+			}
+
+			friend auto operator-(const simd& a, const simd& b) -> simd {
+				return simd(a.v - b.v);
+			}
+
+			friend auto operator*(const simd& a, const simd& b) -> simd {
+				return simd(a.v * b.v);
+			}
+
+			friend auto operator/(const simd& a, const simd& b) -> simd {
+				return simd(a.v / b.v);
+			}
+
+			auto operator+=(const simd& b) -> simd& {
+				v += b.v;
+				return *this;
+			}
+
+			auto operator-=(const simd& b) -> simd& {
+				v -= b.v;
+				return *this;
+			}
+
+			auto operator*=(const simd& b) -> simd& {
+				v *= b.v;
+				return *this;
 			}
+
+			auto operator/=(const simd& b) -> simd& {
+				v /= b.v;
+				return *this;
+			}
+
+			//符号なし整数型のビット演算
+
+			template<typename U = T, enabler<is_unsigned<U>> = nullptr>
+			friend auto operator~(const simd& a) -> simd {
+				return simd(~a.v);
+			}
+
+			template<typename U = T, enabler<is_unsigned<U>> = nullptr>
+			friend auto operator&(const simd& a, const simd& b) -> simd {
+				return simd(a.v & b.v);
+			}
+
+			template<typename U = T, enabler<is_unsigned<U>> = nullptr>
+			friend auto operator|(const simd& a, const simd& b) -> simd {
+				return simd(a.v | b.v);
+			}
+
+			template<typename U = T, enabler<is_unsigned<U>> = nullptr>
+			friend auto operator^(const simd& a, const simd& b) -> simd {
+				return simd(a.v ^ b.v);
+			}
+
+			template<typename U = T, enabler<is_unsigned<U>> = nullptr>
+			friend auto operator<<(const simd& a, int s) -> simd {
+				return simd(a.v << s);
+			}
+
+			template<typename U = T, enabler<is_unsigned<U>> = nullptr>
+			friend auto operator>>(const simd& a, int s) -> simd {
+				return simd(a.v >> s);
+			}
+
+			friend auto operator==(const simd& a, const simd& b) -> mask_type {
+				return mask_type(a.v == b.v);
+			}
+
+			friend auto operator!=(const simd& a, const simd& b) -> mask_type {
+				return mask_type(a.v != b.v);
+			}
+
+			friend auto operator<(const simd& a, const simd& b) -> mask_type {
+				return mask_type(a.v < b.v);
+			}
+
+			friend auto operator<=(const simd& a, const simd& b) -> mask_type {
+				return mask_type(a.v <= b.v);
+			}
+
+			friend auto operator>(const simd& a, const simd& b) -> mask_type {
+				return mask_type(a.v > b.v);
+			}
+
+			friend auto operator>=(const simd& a, const simd& b) -> mask_type {
+				return mask_type(a.v >= b.v);
+			}
+		};
+
+		/**
+		* @brief いずれかの要素が真か
+		*/
+		template<typename T, std::size_t N>
+		auto any(const simd_mask<T, N>& m) -> bool {
+			typename simd_mask<T, N>::element_type r = 0;
+			for (std::size_t i = 0; i < N; ++i) r |= m.v[i];
+			return r != 0;
 		}
 
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto is_pow2(T x) -> bool {
-			return x && !(x & (x - 1));
+		/**
+		* @brief 全ての要素が真か
+		*/
+		template<typename T, std::size_t N>
+		auto all(const simd_mask<T, N>& m) -> bool {
+			return !vector_extension::any(!m);
 		}
 
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto popcount(T x) -> int {
-			if constexpr (spook::is_pow2(sizeof(T))) {
-				return detail::popcount_impl(std::uint64_t(x));
+		/**
+		* @brief 全ての要素が偽か
+		*/
+		template<typename T, std::size_t N>
+		auto none(const simd_mask<T, N>& m) -> bool {
+			return !vector_extension::any(m);
+		}
+
+		/**
+		* @brief 要素毎のm ? a : b
+		*/
+		template<typename T, std::size_t N>
+		auto select(const simd_mask<T, N>& m, const simd<T, N>& a, const simd<T, N>& b) -> simd<T, N> {
+			return simd<T, N>(m.v ? a.v : b.v);
+		}
+
+		namespace detail {
+
+			/**
+			* @brief 各要素にbatchの分岐の無い処理を適用し、NaNを返した要素だけをスカラー版で計算し直す
+			*/
+			template<typename T, std::size_t N, typename Lane, typename Scalar, typename... S>
+			SPOOK_FORCE_INLINE auto apply_lanes(Lane lane, Scalar scalar, const S&... x) -> simd<T, N> {
+				simd<T, N> r;
+				for (std::size_t i = 0; i < N; ++i) {
+					r.v[i] = lane(x.v[i]...);
+				}
+
+				const auto fail = (r != r);
+				if (vector_extension::any(fail)) {
+					for (std::size_t i = 0; i < N; ++i) {
+						if (fail[i]) r.v[i] = scalar(x.v[i]...);
+					}
+				}
+				return r;
+			}
+
+			/**
+			* @brief 各要素にfを適用する
+			*/
+			template<typename T, std::size_t N, typename F, typename... S>
+			SPOOK_FORCE_INLINE auto apply_each(F f, const S&... x) -> simd<T, N> {
+				simd<T, N> r;
+				for (std::size_t i = 0; i < N; ++i) {
+					r.v[i] = f(x.v[i]...);
+				}
+				return r;
+			}
+
+			/**
+			* @brief 各要素のビット列を同じ大きさの符号なし整数として扱う
+			*/
+			template<typename T, std::size_t N>
+			using bits_of = simd<typename batch::detail::lane_bits<T>::bits_t, N>;
+
+			template<typename T, std::size_t N>
+			auto to_bits(const simd<T, N>& x) -> bits_of<T, N> {
+				return bits_of<T, N>(std::bit_cast<typename bits_of<T, N>::native_type>(x.v));
 			}
-			else {
-				return detail::popcount_impl(x);
+
+			template<typename T, std::size_t N, typename Bits>
+			auto from_bits(const simd<Bits, N>& b) -> simd<T, N> {
+				return simd<T, N>(std::bit_cast<typename simd<T, N>::native_type>(b.v));
 			}
 		}
 
-		namespace detail {
-			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint8_t x) -> std::uint8_t {
-				using int_t = std::uint8_t;
-				int_t t = (x  >> 4) | (x  << 4);
-				t = ((t & int_t(0xCCu)) >> 2) | ((t & int_t(0x33u)) << 2);
-				t = ((t & int_t(0xAAu)) >> 1) | ((t & int_t(0x55u)) << 1);
+		//符号の操作
 
-				return t;
-			}
+		template<typename T, std::size_t N>
+		auto fabs(const simd<T, N>& x) -> simd<T, N> {
+			using bits = typename detail::bits_of<T, N>::value_type;
+			return detail::from_bits<T>(detail::to_bits(x) & detail::bits_of<T, N>(~(bits(1) << (sizeof(T) * CHAR_BIT - 1))));
+		}
 
-			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint16_t x) -> std::uint16_t {
-				using int_t = std::uint16_t;
-				int_t t = (x >> 8) | (x << 8);
-				t = ((t & int_t(0xF0F0u)) >> 4) | ((t & int_t(0x0F0Fu)) << 4);
-				t = ((t & int_t(0xCCCCu)) >> 2) | ((t & int_t(0x3333u)) << 2);
-				t = ((t & int_t(0xAAAAu)) >> 1) | ((t & int_t(0x5555u)) << 1);
+		template<typename T, std::size_t N>
+		auto copysign(const simd<T, N>& x, const simd<T, N>& y) -> simd<T, N> {
+			using bits = typename detail::bits_of<T, N>::value_type;
+			const detail::bits_of<T, N> sign(bits(1) << (sizeof(T) * CHAR_BIT - 1));
+			return detail::from_bits<T>((detail::to_bits(x) & ~sign) | (detail::to_bits(y) & sign));
+		}
 
-				return t;
-			}
+		//浮動小数点数の分類、各要素の結果をマスクで返す
 
-			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint32_t x) -> std::uint32_t {
-				using int_t = std::uint32_t;
-				int_t t = (x >> 16) | (x << 16);
-				t = ((t & int_t(0xFF00FF00u)) >> 8) | ((t & int_t(0x00FF00FFu)) << 8);
-				t = ((t & int_t(0xF0F0F0F0u)) >> 4) | ((t & int_t(0x0F0F0F0Fu)) << 4);
-				t = ((t & int_t(0xCCCCCCCCu)) >> 2) | ((t & int_t(0x33333333u)) << 2);
-				t = ((t & int_t(0xAAAAAAAAu)) >> 1) | ((t & int_t(0x55555555u)) << 1);
+		template<typename T, std::size_t N>
+		auto isnan(const simd<T, N>& x) -> simd_mask<T, N> {
+			return x != x;
+		}
 
-				return t;
-			}
+		template<typename T, std::size_t N>
+		auto isinf(const simd<T, N>& x) -> simd_mask<T, N> {
+			return spook::fabs(x) == simd<T, N>(std::numeric_limits<T>::infinity());
+		}
 
-			SPOOK_CONSTEVAL auto bit_reverse_impl(std::uint64_t x) -> std::uint64_t {
-				//最大桁の半分から再帰的に半分づつ入れ替えていく
+		template<typename T, std::size_t N>
+		auto isfinite(const simd<T, N>& x) -> simd_mask<T, N> {
+			return spook::fabs(x) <= simd<T, N>((std::numeric_limits<T>::max)());
+		}
 
-				using int_t = std::uint64_t;
-				int_t t = (x >> 32) | (x << 32);
-				t = ((t & int_t(0xFFFF0000FFFF0000u)) >> 16) | ((t & int_t(0x0000FFFF0000FFFFu)) << 16);
-				t = ((t & int_t(0xFF00FF00FF00FF00u)) >> 8 ) | ((t & int_t(0x00FF00FF00FF00FFu)) << 8);
-				t = ((t & int_t(0xF0F0F0F0F0F0F0F0u)) >> 4 ) | ((t & int_t(0x0F0F0F0F0F0F0F0Fu)) << 4);
-				t = ((t & int_t(0xCCCCCCCCCCCCCCCCu)) >> 2 ) | ((t & int_t(0x3333333333333333u)) << 2);
-				t = ((t & int_t(0xAAAAAAAAAAAAAAAAu)) >> 1 ) | ((t & int_t(0x5555555555555555u)) << 1);
+		template<typename T, std::size_t N>
+		auto iszero(const simd<T, N>& x) -> simd_mask<T, N> {
+			return x == simd<T, N>(T(0.0));
+		}
 
-				return t;
-			}
+		template<typename T, std::size_t N>
+		auto signbit(const simd<T, N>& x) -> simd_mask<T, N> {
+			//最上位ビットを全ビットに広げる
+			const auto sign = detail::to_bits(x) >> int(sizeof(T) * CHAR_BIT - 1);
+			return simd_mask<T, N>(-std::bit_cast<typename simd_mask<T, N>::native_type>(sign.v));
+		}
 
-			template <typename T>
-			SPOOK_CONSTEVAL auto bit_reverse_impl(T x) = delete;
-		} // namespace detail
+		//数学関数、結果はspook::sin等を要素毎に呼んだものと一致する（浮動小数点演算の縮約を行わない場合）
 
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto bit_reverse(T x) -> T {
-			//各型用の二分再帰による実装に移譲
-			return detail::bit_reverse_impl(x);
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto sqrt(const simd<T, N>& x) -> simd<T, N> {
+			return detail::apply_each<T, N>([](T a) { return spook::sqrt(a); }, x);
 		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto rotl(T x, int s) -> T;
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto sin(const simd<T, N>& x) -> simd<T, N> {
+			return detail::apply_lanes<T, N>([](T a) { return batch::detail::sin_lane(a, false); }, [](T a) { return spook::sin(a); }, x);
+		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto rotr(T x, int s) -> T {
-			constexpr auto N = sizeof(T) * CHAR_BIT;
-			const int r = s % N;
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto cos(const simd<T, N>& x) -> simd<T, N> {
+			return detail::apply_lanes<T, N>([](T a) { return batch::detail::sin_lane(a, true); }, [](T a) { return spook::cos(a); }, x);
+		}
 
-			if (r == 0) return x;
-			if (r < 0) return rotl(x, -r);
-			return (x >> r) | (x << (N - r));
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto exp(const simd<T, N>& x) -> simd<T, N> {
+			return detail::apply_lanes<T, N>([](T a) { return batch::detail::exp_lane(a, T(0.0)); }, [](T a) { return spook::exp(a); }, x);
 		}
 
-		template<typename T CONCEPT_FALLBACK_REDECL(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto rotl(T x, int s) -> T {
-			constexpr auto N = sizeof(T) * CHAR_BIT;
-			const int r = s % N;
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto log(const simd<T, N>& x) -> simd<T, N> {
+			return detail::apply_lanes<T, N>([](T a) { return batch::detail::log_lane(a); }, [](T a) { return spook::log(a); }, x);
+		}
 
-			if (r == 0) return x;
-			if (r < 0) return rotr(x, -r);
-			return (x << r) | (x >> (N - r));
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto pow(const simd<T, N>& x, const simd<T, N>& y) -> simd<T, N> {
+			return detail::apply_lanes<T, N>([](T a, T b) { return batch::detail::pow_lane(a, b); }, [](T a, T b) { return spook::pow(a, b); }, x, y);
 		}
 
-		template<typename T CONCEPT_FALLBACK_REDECL(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto countr_zero(T x) -> int {
-			if (x == 0) return sizeof(T) * CHAR_BIT;
+		template<typename T, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto atan2(const simd<T, N>& y, const simd<T, N>& x) -> simd<T, N> {
+			return detail::apply_lanes<T, N>([](T a, T b) { return batch::detail::atan2_lane(a, b); }, [](T a, T b) { return spook::atan2(a, b); }, y, x);
+		}
 
-			int n = spook::lsb_pos(x);
-			return --n;
+		//ビット関数、各要素の結果を同じ型の要素で返す
+
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto popcount(const simd<T, N>& x) -> simd<T, N> {
+			using v = simd<T, N>;
+			constexpr T ones = T(~T(0));
+
+			//2, 4, 8ビット毎の和を求めてから、バイト毎の和を最上位バイトに集める
+			v r = x - ((x >> 1) & v(ones / 3));
+			r = (r & v(ones / 15 * 3)) + ((r >> 2) & v(ones / 15 * 3));
+			r = (r + (r >> 4)) & v(ones / 255 * 15);
+
+			if constexpr (sizeof(T) == 1) {
+				return r;
+			} else {
+				return (r * v(ones / 255)) >> int((sizeof(T) - 1) * CHAR_BIT);
+			}
 		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto countr_one(T x) -> int {
-			if (x == 0) return 0;
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto countr_zero(const simd<T, N>& x) -> simd<T, N> {
+			//最下位の1より下の0だけを1にして数える、0なら全ビット
+			return vector_extension::popcount(~x & (x - simd<T, N>(T(1))));
+		}
 
-			return spook::countr_zero(~x);
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto countl_zero(const simd<T, N>& x) -> simd<T, N> {
+			//最上位の1より下を全て1にしてから、残った0を数える
+			simd<T, N> r = x;
+			for (int s = 1; s < int(sizeof(T) * CHAR_BIT); s *= 2) {
+				r = r | (r >> s);
+			}
+			return vector_extension::popcount(~r);
 		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto countl_zero(T x) -> int {
-			if (x == 0) return sizeof(T) * CHAR_BIT;
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto countr_one(const simd<T, N>& x) -> simd<T, N> {
+			return vector_extension::countr_zero(~x);
+		}
 
-			auto n = spook::msb_pos(x);
-			return (sizeof(T) * CHAR_BIT) - n;
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto countl_one(const simd<T, N>& x) -> simd<T, N> {
+			return vector_extension::countl_zero(~x);
 		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto countl_one(T x) -> int{
-			if (x == 0) return 0;
-			return spook::countl_zero(~x);
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto rotl(const simd<T, N>& x, int s) -> simd<T, N> {
+			constexpr int W = sizeof(T) * CHAR_BIT;
+			const int r = s & (W - 1);
+
+			//r == 0の時もシフト量がWにならないようにする
+			return (x << r) | (x >> ((W - r) & (W - 1)));
 		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto ceil2(T x) -> T {
-			if (x == T(0)) return T(1);
+		template<typename T, std::size_t N, enabler<is_unsigned<T>> = nullptr>
+		auto rotr(const simd<T, N>& x, int s) -> simd<T, N> {
+			return vector_extension::rotl(x, -s);
+		}
 
-			//丁度2^Nの値を正しく出力するために1引いておく
-			--x;
-			T v = T(detail::fill_msb_less_one(std::uint64_t(x)));
-			//帰ってきた値が全て１で埋まっていた場合（TのビットをNとすると2^N <= xの場合）、結果は正しくない
-			return ++v;
+		namespace detail {
+
+			/**
+			* @brief 要素毎の誤差なしの乗算（a * b = p + e）
+			* @detail 高速なfma命令があればそれで、無ければDekkerの方法で誤差を求める（結果は同じ）
+			*/
+			template<typename T, std::size_t N>
+			SPOOK_FORCE_INLINE auto two_prod(const simd<T, N>& a, const simd<T, N>& b) -> std::pair<simd<T, N>, simd<T, N>> {
+				const simd<T, N> p = a * b;
+
+				if constexpr (cmath::detail::has_fast_fma<T>) {
+					simd<T, N> e;
+					for (std::size_t i = 0; i < N; ++i) {
+						e.v[i] = std::fma(a.v[i], b.v[i], -p.v[i]);
+					}
+					return { p, e };
+				} else {
+					constexpr int half = (spook::numeric_limits_traits<T>::digits + 1) / 2;
+					const simd<T, N> splitter(cmath::detail::scale2(T(1.0), half) + T(1.0));
+
+					const auto split = [&splitter](const simd<T, N>& x) -> std::pair<simd<T, N>, simd<T, N>> {
+						const simd<T, N> c = splitter * x;
+						const simd<T, N> hi = c - (c - x);
+						return { hi, x - hi };
+					};
+
+					const auto [ah, al] = split(a);
+					const auto [bh, bl] = split(b);
+
+					return { p, ((ah * bh - p) + ah * bl + al * bh) + al * bl };
+				}
+			}
 		}
 
-		template<typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto floor2(T x) -> T {
-			if (x == T(0)) return T(0);
+		//多項式の評価、係数は昇順（spook::horner等と同じ）
 
-			T v = T(detail::fill_msb_less_one(std::uint64_t(x)));
-			return v ^ (v >> 1);	//最上位ビットだけを残す
+		template<typename T, std::size_t C, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto horner(const std::array<T, C>& c, const simd<T, N>& x) -> simd<T, N> {
+			return polynomial::detail::horner_sum(c, x);
 		}
 
-		template <typename T CONCEPT_FALLBACK(spook::unsigned_integral<T, enabler<is_unsigned<T>>)>
-		SPOOK_CONSTEVAL auto log2p1(T x) -> T {
-			//log2p1はすなわち最上位ビットの位置！
-			return T(spook::msb_pos(x));
+		template<typename T, std::size_t C, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto estrin(const std::array<T, C>& c, const simd<T, N>& x) -> simd<T, N> {
+			return polynomial::detail::estrin_sum(c, x);
 		}
 
-		template<typename R = std::uint64_t CONCEPT_FALLBACK(spook::unsigned_integral<R, enabler<is_unsigned<R>>)>
-		SPOOK_CONSTEVAL auto pow2(unsigned int n) -> R {
-			return R(1) << n;
+		template<typename T, std::size_t C, std::size_t N, enabler<std::is_floating_point<T>> = nullptr>
+		SPOOK_FORCE_INLINE auto compensated_horner(const std::array<T, C>& c, const simd<T, N>& x) -> simd<T, N> {
+			return polynomial::detail::compensated_horner_sum(c, x, [](const simd<T, N>& a, const simd<T, N>& b) { return detail::two_prod(a, b); });
 		}
 	}
 
-	inline namespace functional {
+#endif // __GNUC__
+
+#if defined(__cpp_lib_span) && defined(__cpp_lib_bit_cast)
+
+	/**
+	* @brief 連続した配列に対して数学関数をまとめて計算する
+	* @detail 結果はspook::sin等の同名の関数を要素毎に呼んだものと一致する（浮動小数点演算の縮約（FMA化）を行わない場合）
+	* @detail 特別な値や還元の難しい範囲を除いて分岐の無い処理で計算し、コンパイラの自動ベクトル化に任せる
+	* @detail 命令セットはコンパイル時の対象（-mavx2、-mavx512f等）に従う。GCCでは-O3（またはベクトル化を有効にした-O2）で展開される
+	*/
+	namespace batch {
 
 		namespace detail {
 
+			/**
+			* @brief 1度に処理する要素数、ベクトルレジスタ8本分
+			*/
 			template<typename T>
-			struct is_reference_wrapper : std::false_type {};
-			
-			template<typename T>
-			struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type {};
+			inline constexpr std::size_t block_size = 8 * simd_width<T>;
 
+			/**
+			* @brief 分岐の無い処理を持つ型か
+			*/
 			template<typename T>
-			inline constexpr bool is_reference_wrapper_v = detail::is_reference_wrapper<T>::value;
+			inline constexpr bool has_lane_kernel = (std::is_same_v<T, float> || std::is_same_v<T, double>) && cmath::detail::float_layout<T>::available;
 
-			template<typename F, typename T, typename... Args>
-			SPOOK_CONSTEVAL decltype(auto) invoke_memfn(F&& f, T&& t1, Args&&... args) {
-				using prime_t = std::remove_cvref_t<decltype(t1)>;
-
-				if constexpr (std::is_base_of_v<type_traits::memberptr_to_t<F>, prime_t>) {
-					return (std::forward<T>(t1).*f)(std::forward<Args>(args)...);
+			/**
+			* @brief 要素数の短い方に揃える
+			*/
+			template<typename T, std::size_t Arity>
+			auto common_size(const std::span<const T> (&in)[Arity], std::span<T> out) -> std::size_t {
+				std::size_t n = out.size();
+				for (const auto& s : in) {
+					if (s.size() < n) n = s.size();
 				}
-				else if constexpr (detail::is_reference_wrapper_v<prime_t>) {
-					return (std::forward<T>(t1).get().*f)(std::forward<Args>(args)...);
-				} else {
-					return ((*std::forward<T>(t1)).*f)(std::forward<Args>(args)...);
+				return n;
+			}
+
+			/**
+			* @brief 全要素にスカラー版を適用する
+			*/
+			template<typename T, std::size_t Arity, typename Scalar, std::size_t... I>
+			void transform_scalar(const std::span<const T> (&in)[Arity], std::span<T> out, Scalar scalar, std::index_sequence<I...>) {
+				const std::size_t n = detail::common_size(in, out);
+
+				for (std::size_t i = 0; i < n; ++i) {
+					out[i] = scalar(in[I][i]...);
 				}
 			}
 
-			template <typename F, typename T>
-			SPOOK_CONSTEVAL decltype(auto) invoke_memobj(F&& f, T&& t1) {
-				using prime_t = std::remove_cvref_t<decltype(t1)>;
+			/**
+			* @brief block_size毎に区切って、各要素にlaneを適用する
+			* @param lane 分岐の無い処理、扱えない要素にはNaNを返す
+			* @param scalar laneがNaNを返した要素に使うスカラー版
+			* @detail 端数と境界の揃っていない配列は一旦作業領域に写してから処理する。inとoutが同じ領域でもよい
+			*/
+			template<typename T, std::size_t Arity, typename Lane, typename Scalar, std::size_t... I>
+			void transform(const std::span<const T> (&in)[Arity], std::span<T> out, Lane lane, Scalar scalar, std::index_sequence<I...>) {
+				constexpr std::size_t B = block_size<T>;
+				const std::size_t n = detail::common_size(in, out);
 
-				if constexpr (std::is_base_of_v<type_traits::memberptr_to_t<F>, prime_t>) {
-					return std::forward<T>(t1).*f;
-				} else if constexpr (detail::is_reference_wrapper_v<prime_t>) {
-					return std::forward<T>(t1).get().*f;
+				alignas(vector_bytes) T x[Arity][B];
+				alignas(vector_bytes) T y[B];
+
+				for (std::size_t first = 0; first < n; first += B) {
+					const std::size_t count = (B < n - first) ? B : n - first;
+
+					//端数は安全な値で埋める
+					for (std::size_t a = 0; a < Arity; ++a) {
+						for (std::size_t i = 0; i < B; ++i) x[a][i] = T(1.0);
+						for (std::size_t i = 0; i < count; ++i) x[a][i] = in[a][first + i];
+					}
+
+					for (std::size_t i = 0; i < B; ++i) {
+						y[i] = lane(x[I][i]...);
+					}
+
+					bool all = true;
+					for (std::size_t i = 0; i < B; ++i) {
+						all = all & (y[i] == y[i]);
+					}
+
+					if (all) {
+						for (std::size_t i = 0; i < count; ++i) out[first + i] = y[i];
+					} else {
+						for (std::size_t i = 0; i < count; ++i) {
+							out[first + i] = (y[i] == y[i]) ? y[i] : scalar(x[I][i]...);
+						}
+					}
+				}
+			}
+
+			/**
+			* @brief 型に応じてtransformかtransform_scalarを呼ぶ
+			*/
+			template<typename T, std::size_t Arity, typename Lane, typename Scalar>
+			void dispatch(const std::span<const T> (&in)[Arity], std::span<T> out, Lane lane, Scalar scalar) {
+				if constexpr (has_lane_kernel<T>) {
+					detail::transform(in, out, lane, scalar, std::make_index_sequence<Arity>{});
 				} else {
-					return (*std::forward<T>(t1)).*f;
+					detail::transform_scalar(in, out, scalar, std::make_index_sequence<Arity>{});
 				}
 			}
 		}
 
-		template<typename F, typename... Args>
-		SPOOK_CONSTEVAL auto invoke(F&& f, Args&&... args) -> std::invoke_result_t<F, Args...> {
-			using prime_t = std::remove_cvref_t<F>;
+		/**
+		* @brief out[i] = spook::sin(in[i])
+		* @param in 入力、outと同じ領域でもよい
+		* @param out 出力、inと同じ要素数であること（異なる場合は短い方まで計算する）
+		*/
+		template<typename T>
+		void sin(std::span<const T> in, std::span<T> out) {
+			detail::dispatch({ in }, out, [](auto x) { return detail::sin_lane(x, false); }, [](T x) { return spook::sin(x); });
+		}
 
-			if constexpr (std::is_member_function_pointer_v<prime_t>) {
-				//メンバポインタ呼び出し
-				return detail::invoke_memfn(std::forward<F>(f), std::forward<Args>(args)...);
-			} else if constexpr (sizeof...(Args) == 1 && std::is_member_object_pointer_v<prime_t>) {
-				//メンバオブジェクト呼び出し
-				return detail::invoke_memobj(std::forward<F>(f), std::forward<Args>(args)...);
-			} else {
-				//その他関数呼び出し
-				return std::forward<F>(f)(std::forward<Args>(args)...);
-			}
+		/**
+		* @brief out[i] = spook::cos(in[i])
+		*/
+		template<typename T>
+		void cos(std::span<const T> in, std::span<T> out) {
+			detail::dispatch({ in }, out, [](auto x) { return detail::sin_lane(x, true); }, [](T x) { return spook::cos(x); });
 		}
-	}
 
-	inline namespace tuple {
+		/**
+		* @brief out[i] = spook::exp(in[i])
+		*/
+		template<typename T>
+		void exp(std::span<const T> in, std::span<T> out) {
+			detail::dispatch({ in }, out, [](auto x) { return detail::exp_lane(x, T(0.0)); }, [](T x) { return spook::exp(x); });
+		}
 
-		namespace detail {
-			template <typename F, typename Tuple, std::size_t... Index>
-			SPOOK_CONSTEVAL decltype(auto) apply_impl(F&& f, Tuple&& t, std::index_sequence<Index...>) {
-				return spook::invoke(std::forward<F>(f), std::get<Index>(std::forward<Tuple>(t))...);
-			}
+		/**
+		* @brief out[i] = spook::log(in[i])
+		*/
+		template<typename T>
+		void log(std::span<const T> in, std::span<T> out) {
+			detail::dispatch({ in }, out, [](auto x) { return detail::log_lane(x); }, [](T x) { return spook::log(x); });
+		}
 
-			template <typename T, typename Tuple, std::size_t... Index>
-			SPOOK_CONSTEVAL auto make_from_tuple_impl(Tuple&& t, std::index_sequence<Index...>) -> T {
-				return T(std::get<Index>(std::forward<Tuple>(t))...);
-			}
+		/**
+		* @brief out[i] = spook::sqrt(in[i])
+		*/
+		template<typename T>
+		void sqrt(std::span<const T> in, std::span<T> out) {
+			//実行時のspook::sqrtはsqrt命令そのものなので、作業領域を介さずに要素毎に呼ぶ（errnoを使わない設定ならそのままベクトル化される）
+			detail::transform_scalar({ in }, out, [](T x) { return spook::sqrt(x); }, std::index_sequence<0>{});
 		}
 
-		template<typename F, typename Tuple>
-		SPOOK_CONSTEVAL auto apply(F&& f, Tuple&& t) -> decltype(std::apply(std::declval<F&>(), std::declval<Tuple&>())) {
-			using prime_tuple_t = std::remove_reference_t<Tuple>;
-			
-			return detail::apply_impl(std::forward<F>(f), std::forward<Tuple>(t), std::make_index_sequence<std::tuple_size_v<prime_tuple_t>>{});
+		/**
+		* @brief out[i] = spook::pow(x[i], y[i])
+		*/
+		template<typename T>
+		void pow(std::span<const T> x, std::span<const T> y, std::span<T> out) {
+			detail::dispatch({ x, y }, out, [](auto b, auto e) { return detail::pow_lane(b, e); }, [](T b, T e) { return spook::pow(b, e); });
 		}
 
-		template<typename T, typename Tuple>
-		SPOOK_CONSTEVAL auto make_from_tuple(Tuple&& t) -> T {
-			using prime_tuple_t = std::remove_reference_t<Tuple>;
+		/**
+		* @brief out[i] = spook::atan2(y[i], x[i])
+		*/
+		template<typename T>
+		void atan2(std::span<const T> y, std::span<const T> x, std::span<T> out) {
+			detail::dispatch({ y, x }, out, [](auto b, auto a) { return detail::atan2_lane(b, a); }, [](T b, T a) { return spook::atan2(b, a); });
+		}
 
-			return detail::make_from_tuple_impl<T>(std::forward<Tuple>(t), std::make_index_sequence<std::tuple_size_v<prime_tuple_t>>{});
+		/**
+		* @brief out[i] = spook::horner(c, in[i])
+		* @detail 分岐の無い算術演算だけなので、作業領域を介さずに要素毎に呼ぶ（estrin、compensated_hornerも同様）
+		*/
+		template<typename T, std::size_t N>
+		void horner(const std::array<T, N>& c, std::span<const T> in, std::span<T> out) {
+			detail::transform_scalar({ in }, out, [&c](T x) { return spook::horner(c, x); }, std::index_sequence<0>{});
+		}
+
+		/**
+		* @brief out[i] = spook::estrin(c, in[i])
+		*/
+		template<typename T, std::size_t N>
+		void estrin(const std::array<T, N>& c, std::span<const T> in, std::span<T> out) {
+			detail::transform_scalar({ in }, out, [&c](T x) { return spook::estrin(c, x); }, std::index_sequence<0>{});
+		}
+
+		/**
+		* @brief out[i] = spook::compensated_horner(c, in[i])
+		*/
+		template<typename T, std::size_t N>
+		void compensated_horner(const std::array<T, N>& c, std::span<const T> in, std::span<T> out) {
+			detail::transform_scalar({ in }, out, [&c](T x) { return spook::compensated_horner(c, x); }, std::index_sequence<0>{});
 		}
 	}
+
+#endif // __cpp_lib_span
 }
\ No newline at end of file
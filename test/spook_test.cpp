@@ -4,4 +4,5 @@
 #include "testheader/cmath_test.hpp"
 #include "testheader/bit_test.hpp"
 #include "testheader/functional_test.hpp"
-#include "testheader/numelic_test.hpp"
\ No newline at end of file
+#include "testheader/numelic_test.hpp"
+#include "testheader/double_double_test.hpp"
\ No newline at end of file
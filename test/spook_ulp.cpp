@@ -0,0 +1,580 @@
+﻿#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "spook.hpp"
+
+/**
+* spook::cmathの浮動小数点関数の精度をULP誤差で評価する
+* @detail floatは全2^32ビットパターン（定義域内）を網羅し、doubleは定義域内を密にサンプリングする
+* @detail 参照値はlong double版の<cmath>の関数による（x87の80bit long doubleでdoubleに対して11bit余分な精度）
+* @detail long doubleがdoubleと同じ精度の処理系（MSVC、AArch64のmacOS等）では参照値にならないので、doubleの評価は飛ばす
+* @detail 実行時に<cmath>へ振り分けられる関数（fabs, floor, sqrt, fmod等）は、定数式で計算した標本の表も評価する（名前の末尾が/constexpr）
+* @detail 関数毎のULP誤差の予算を超えた場合は失敗（終了コード1）とする
+* usage: spook_ulp [--filter=SUBSTR] [--float-stride=N] [--double-samples=N] [--threads=N]
+*/
+
+namespace spook_ulp {
+
+	struct options {
+		std::string filter{};
+		std::uint64_t float_stride = 1;
+		std::uint64_t double_samples = std::uint64_t(1) << 22;
+		unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+	};
+
+	inline options opt{};
+	inline bool failed = false;
+
+	/**
+	* @brief 評価区間、関数の定義域のうち計測対象とする範囲
+	*/
+	struct domain {
+		double lo;
+		double hi;
+	};
+
+	struct stats {
+		std::uint64_t count = 0;
+		std::uint64_t mismatch = 0;	//Inf/NaNになるべきか否かが一致しない数
+		std::uint64_t misrounded = 0;	//参照値をTに丸めた値と異なる数
+		long double max_ulp = 0.0L;
+		long double sum_ulp = 0.0L;
+		long double worst_x = 0.0L;
+		long double worst_y = 0.0L;
+
+		void merge(const stats& other) {
+			count += other.count;
+			mismatch += other.mismatch;
+			misrounded += other.misrounded;
+			sum_ulp += other.sum_ulp;
+			if (max_ulp < other.max_ulp) {
+				max_ulp = other.max_ulp;
+				worst_x = other.worst_x;
+				worst_y = other.worst_y;
+			}
+		}
+	};
+
+	/**
+	* @brief 参照値refの位置での型Tの1ULPの大きさ
+	*/
+	template<typename T>
+	auto ulp_of(long double ref) -> long double {
+		int e{};
+		std::frexp(ref, &e);
+		//非正規化数の範囲ではULPは一定
+		e = (std::max)(e, std::numeric_limits<T>::min_exponent);
+		return std::ldexp(1.0L, e - std::numeric_limits<T>::digits);
+	}
+
+	template<typename T>
+	void accumulate(stats& s, T got, long double ref, long double x, long double y = 0.0L) {
+		++s.count;
+
+		const T expected = T(ref);
+		const bool expected_special = std::isnan(expected) || std::isinf(expected);
+		const bool got_special = std::isnan(got) || std::isinf(got);
+
+		if (expected_special || got_special) {
+			const bool same = (std::isnan(expected) && std::isnan(got)) || (expected == got);
+			if (!same) {
+				++s.mismatch;
+				s.worst_x = x;
+				s.worst_y = y;
+			}
+			return;
+		}
+
+		const long double err = std::fabs(static_cast<long double>(got) - ref) / ulp_of<T>(ref);
+		if (got != expected) ++s.misrounded;
+		s.sum_ulp += err;
+		if (s.max_ulp < err) {
+			s.max_ulp = err;
+			s.worst_x = x;
+			s.worst_y = y;
+		}
+	}
+
+	/**
+	* @brief [0, n)をスレッド数で分割して並列に実行し、結果をまとめる
+	*/
+	template<typename Body>
+	auto parallel(std::uint64_t n, Body body) -> stats {
+		const unsigned thread_count = opt.threads;
+		std::vector<stats> partial(thread_count);
+		std::vector<std::thread> threads;
+
+		for (unsigned t = 0; t < thread_count; ++t) {
+			threads.emplace_back([&, t] {
+				const std::uint64_t begin = n / thread_count * t;
+				const std::uint64_t end = (t + 1 == thread_count) ? n : n / thread_count * (t + 1);
+				body(partial[t], begin, end, t);
+			});
+		}
+
+		stats total{};
+		for (unsigned t = 0; t < thread_count; ++t) {
+			threads[t].join();
+			total.merge(partial[t]);
+		}
+		return total;
+	}
+
+	inline auto float_from_bits(std::uint32_t bits) -> float {
+		float f;
+		std::memcpy(&f, &bits, sizeof(f));
+		return f;
+	}
+
+	inline auto double_from_bits(std::uint64_t bits) -> double {
+		double d;
+		std::memcpy(&d, &bits, sizeof(d));
+		return d;
+	}
+
+	inline auto bits_of(double d) -> std::uint64_t {
+		std::uint64_t bits;
+		std::memcpy(&bits, &d, sizeof(bits));
+		return bits;
+	}
+
+	/**
+	* @brief 定義域内のdoubleをサンプリングする
+	* @detail 半数はビットパターン上で一様（全ての指数を均等に）、残りは値として一様に選ぶ
+	*/
+	inline auto sample_double(std::mt19937_64& engine, domain d) -> double {
+		if (engine() & 1u) {
+			return std::uniform_real_distribution<double>(d.lo, d.hi)(engine);
+		}
+
+		//負の部分[lo, -0]と正の部分[+0, hi]のうち、存在する方を選ぶ
+		const bool has_negative = d.lo < 0.0;
+		const bool has_positive = 0.0 <= d.hi;
+		const bool negative = has_negative && (!has_positive || (engine() & 2u));
+
+		const double a = negative ? (std::max)(-d.hi, 0.0) : (std::max)(d.lo, 0.0);
+		const double b = negative ? -d.lo : d.hi;
+		const std::uint64_t bits = std::uniform_int_distribution<std::uint64_t>(bits_of(a), bits_of(b))(engine);
+		const double v = double_from_bits(bits);
+
+		return negative ? -v : v;
+	}
+
+	inline auto selected(const char* name) -> bool {
+		return opt.filter.empty() || std::strstr(name, opt.filter.c_str()) != nullptr;
+	}
+
+	/**
+	* @brief long doubleの参照値がTより精度が高いか
+	*/
+	/**
+	* @brief 参照値をTに丸めた値が正しく丸めた値と見なせるか（参照値の誤差に対して、超越関数の値が丸めの境界にそれより近づく入力は現れないと見なす）
+	*/
+	template<typename T>
+	inline constexpr bool exact_reference = 2 * std::numeric_limits<T>::digits + 8 <= std::numeric_limits<long double>::digits;
+
+	template<typename T>
+	inline constexpr bool has_reference = std::numeric_limits<T>::digits < std::numeric_limits<long double>::digits;
+
+	/**
+	* @brief 参照値の精度が足りない型なら、評価しないことを表示する
+	*/
+	template<typename T>
+	auto skipped(const char* name) -> bool {
+		if (has_reference<T>) return false;
+
+		const char* type = std::is_same_v<T, float> ? "float" : "double";
+		std::printf("%-18s %-6s skipped (long double is not wider than %s)\n", name, type, type);
+		std::fflush(stdout);
+		return true;
+	}
+
+	/**
+	* @brief 結果を表示し、予算を超えていれば失敗とする
+	* @param budget 参照値が正しく丸められる型で0.5以下なら、参照値をTに丸めた値と1つでも異なれば失敗とする
+	*/
+	inline void report(const char* name, const char* type, domain d, domain d2, bool binary, const stats& s, double budget, bool exact) {
+		const bool report_only = std::isinf(budget);
+		const bool rounded = exact && budget <= 0.5;
+		const bool pass = s.mismatch == 0 && s.max_ulp <= budget && !(rounded && s.misrounded != 0);
+		failed |= !(report_only || pass);
+
+		const double mean = s.count == s.mismatch ? 0.0 : double(s.sum_ulp / (s.count - s.mismatch));
+		char range[96];
+		if (binary) {
+			std::snprintf(range, sizeof(range), "[%g, %g]x[%g, %g]", d.lo, d.hi, d2.lo, d2.hi);
+		} else {
+			std::snprintf(range, sizeof(range), "[%g, %g]", d.lo, d.hi);
+		}
+
+		std::printf("%-18s %-6s %-34s %12llu %12.4g %10.4g %8llu %10g  %s  (worst: %.17Lg", name, type, range,
+			static_cast<unsigned long long>(s.count), double(s.max_ulp), mean, static_cast<unsigned long long>(s.mismatch), budget, report_only ? "----" : pass ? "PASS" : "FAIL", s.worst_x);
+		if (binary) std::printf(", %.17Lg", s.worst_y);
+		std::printf(")");
+		if (rounded) std::printf("  misrounded: %llu", static_cast<unsigned long long>(s.misrounded));
+		std::printf("\n");
+		std::fflush(stdout);
+	}
+
+	/**
+	* @brief floatの1引数関数を、定義域内の全ビットパターンについて評価する
+	*/
+	template<typename F, typename Ref>
+	void sweep_float(const char* name, domain d, double budget, F f, Ref ref) {
+		if (!selected(name)) return;
+
+		const std::uint64_t stride = opt.float_stride;
+		const std::uint64_t n = ((std::uint64_t(1) << 32) + stride - 1) / stride;
+
+		auto s = parallel(n, [&](stats& local, std::uint64_t begin, std::uint64_t end, unsigned) {
+			for (std::uint64_t i = begin; i < end; ++i) {
+				const float x = float_from_bits(std::uint32_t(i * stride));
+				//NaNは定義域に関わらず対象外
+				if (!(d.lo <= x && x <= d.hi)) continue;
+
+				accumulate(local, f(x), ref(static_cast<long double>(x)), x);
+			}
+		});
+
+		report(name, "float", d, {}, false, s, budget, exact_reference<float>);
+	}
+
+	/**
+	* @brief 1引数関数を、定義域内でサンプリングして評価する
+	*/
+	template<typename T, typename F, typename Ref>
+	void sample_unary(const char* name, domain d, double budget, F f, Ref ref) {
+		if (!selected(name) || skipped<T>(name)) return;
+
+		auto s = parallel(opt.double_samples, [&](stats& local, std::uint64_t begin, std::uint64_t end, unsigned t) {
+			std::mt19937_64 engine{ 0x5EED + t };
+			for (std::uint64_t i = begin; i < end; ++i) {
+				const T x = T(sample_double(engine, d));
+				accumulate(local, f(x), ref(static_cast<long double>(x)), x);
+			}
+		});
+
+		report(name, std::is_same_v<T, float> ? "float" : "double", d, {}, false, s, budget, exact_reference<T>);
+	}
+
+	/**
+	* @brief 2引数関数を、定義域内でサンプリングして評価する
+	*/
+	template<typename T, typename F, typename Ref>
+	void sample_binary(const char* name, domain d1, domain d2, double budget, F f, Ref ref) {
+		if (!selected(name) || skipped<T>(name)) return;
+
+		auto s = parallel(opt.double_samples, [&](stats& local, std::uint64_t begin, std::uint64_t end, unsigned t) {
+			std::mt19937_64 engine{ 0x5EED + t };
+			for (std::uint64_t i = begin; i < end; ++i) {
+				const T x = T(sample_double(engine, d1));
+				const T y = T(sample_double(engine, d2));
+				accumulate(local, f(x, y), ref(static_cast<long double>(x), static_cast<long double>(y)), x, y);
+			}
+		});
+
+		report(name, std::is_same_v<T, float> ? "float" : "double", d1, d2, true, s, budget, exact_reference<T>);
+	}
+
+	/**
+	* @brief 1引数関数をfloat（全数）とdouble（サンプリング）で評価する
+	*/
+	template<typename F, typename Ref>
+	void unary(const char* name, domain d, double float_budget, double double_budget, F f, Ref ref) {
+		sweep_float(name, d, float_budget, [&](float x) { return f(x); }, ref);
+		sample_unary<double>(name, d, double_budget, [&](double x) { return f(x); }, ref);
+	}
+
+	template<typename F, typename Ref>
+	void binary(const char* name, domain d1, domain d2, double float_budget, double double_budget, F f, Ref ref) {
+		sample_binary<float>(name, d1, d2, float_budget, [&](float x, float y) { return f(x, y); }, ref);
+		sample_binary<double>(name, d1, d2, double_budget, [&](double x, double y) { return f(x, y); }, ref);
+	}
+
+	/**
+	* @brief 定数式で評価する標本の数
+	* @detail 実行時に<cmath>へ振り分けられる関数は、実行時の呼び出しでは定数式向けの実装を通らないので、定数式で計算した表を調べる
+	*/
+	inline constexpr std::size_t constexpr_samples = 512;
+
+	/**
+	* @brief 定数式で使える擬似乱数（splitmix64）
+	*/
+	constexpr auto splitmix64(std::uint64_t& state) -> std::uint64_t {
+		std::uint64_t z = (state += 0x9E3779B97F4A7C15u);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+		return z ^ (z >> 31);
+	}
+
+	/**
+	* @brief 定義域内の値を定数式で選ぶ
+	* @detail sample_doubleと同じく、半数は値として一様、残りは指数を一様に選ぶ
+	*/
+	template<typename T>
+	constexpr auto constexpr_sample(std::uint64_t& state, domain d) -> T {
+		const double u = double(splitmix64(state) >> 11) * 0x1.0p-53;
+
+		if (splitmix64(state) & 1u) {
+			return T(d.lo + (d.hi - d.lo) * u);
+		}
+
+		//[lo, hi]のうち絶対値の大きい側の指数から、2^-64までの指数を一様に選ぶ
+		const double a = (std::max)(spook::fabs(d.lo), spook::fabs(d.hi));
+		const int top = spook::ilogb(a);
+		const int e = top - int(splitmix64(state) % std::uint64_t(top + 65));
+		const double v = (std::min)(spook::ldexp(1.0 + u, e), a);
+		const double x = (d.lo < 0.0 && (splitmix64(state) & 2u)) ? -v : v;
+
+		return T((x < d.lo) ? d.lo : (d.hi < x) ? d.hi : x);
+	}
+
+	/**
+	* @brief 定数式で評価した引数と結果の組
+	*/
+	template<typename T>
+	struct constexpr_result {
+		T x;
+		T y;
+		T result;
+	};
+
+	template<typename T, typename F>
+	constexpr auto constexpr_unary_results(domain d, F f) -> std::array<constexpr_result<T>, constexpr_samples> {
+		std::array<constexpr_result<T>, constexpr_samples> results{};
+		std::uint64_t state = 0x5EED;
+
+		for (auto& r : results) {
+			r.x = constexpr_sample<T>(state, d);
+			r.result = f(r.x);
+		}
+		return results;
+	}
+
+	template<typename T, typename F>
+	constexpr auto constexpr_binary_results(domain d1, domain d2, F f) -> std::array<constexpr_result<T>, constexpr_samples> {
+		std::array<constexpr_result<T>, constexpr_samples> results{};
+		std::uint64_t state = 0x5EED;
+
+		for (auto& r : results) {
+			r.x = constexpr_sample<T>(state, d1);
+			r.y = constexpr_sample<T>(state, d2);
+			r.result = f(r.x, r.y);
+		}
+		return results;
+	}
+
+	/**
+	* @brief 定数式で計算した結果を参照値と比べる
+	*/
+	template<typename T, typename Ref>
+	void check_constexpr(const char* name, domain d1, domain d2, bool binary, double budget, const std::array<constexpr_result<T>, constexpr_samples>& results, Ref ref) {
+		if (!selected(name) || skipped<T>(name)) return;
+
+		stats s{};
+		for (const auto& r : results) {
+			if constexpr (std::is_invocable_v<Ref, long double>) {
+				accumulate(s, r.result, ref(static_cast<long double>(r.x)), r.x);
+			} else {
+				accumulate(s, r.result, ref(static_cast<long double>(r.x), static_cast<long double>(r.y)), r.x, r.y);
+			}
+		}
+
+		report(name, std::is_same_v<T, float> ? "float" : "double", d1, d2, binary, s, budget, exact_reference<T>);
+	}
+
+	/**
+	* @brief 1引数関数の定数式での結果をfloatとdoubleで評価する
+	* @param float_results, double_results constexpr_unary_resultsで作った表
+	*/
+	template<typename Ref>
+	void constexpr_unary(const char* name, domain d, double budget, const std::array<constexpr_result<float>, constexpr_samples>& float_results, const std::array<constexpr_result<double>, constexpr_samples>& double_results, Ref ref) {
+		check_constexpr(name, d, {}, false, budget, float_results, ref);
+		check_constexpr(name, d, {}, false, budget, double_results, ref);
+	}
+
+	template<typename Ref>
+	void constexpr_binary(const char* name, domain d1, domain d2, double budget, const std::array<constexpr_result<float>, constexpr_samples>& float_results, const std::array<constexpr_result<double>, constexpr_samples>& double_results, Ref ref) {
+		check_constexpr(name, d1, d2, true, budget, float_results, ref);
+		check_constexpr(name, d1, d2, true, budget, double_results, ref);
+	}
+
+	inline void run() {
+		constexpr double inf = std::numeric_limits<double>::infinity();
+		constexpr double pi = spook::pi<>;
+		//floor等の内部でstd::size_tへ変換するため、それを超えない範囲
+		constexpr double size_max = 1.8e19;
+
+		//関数名, 定義域, floatの予算[ULP], doubleの予算[ULP]
+		//予算がinfのものは計測のみ行う
+		unary("fabs", { -1.0e300, 1.0e300 }, 0.0, 0.0, [](auto x) { return spook::fabs(x); }, [](long double x) { return std::fabs(x); });
+		unary("floor", { -size_max, size_max }, 0.0, 0.0, [](auto x) { return spook::floor(x); }, [](long double x) { return std::floor(x); });
+		unary("ceil", { -size_max, size_max }, 0.0, 0.0, [](auto x) { return spook::ceil(x); }, [](long double x) { return std::ceil(x); });
+		unary("trunc", { -size_max, size_max }, 0.0, 0.0, [](auto x) { return spook::trunc(x); }, [](long double x) { return std::trunc(x); });
+		unary("round_to_nearest", { -9.2e18, 9.2e18 }, inf, inf, [](auto x) { return spook::round_to_nearest(x); }, [](long double x) { return std::nearbyint(x); });
+
+		binary("fmod", { -1.0e6, 1.0e6 }, { 1.0e-3, 1.0e3 }, inf, inf, [](auto x, auto y) { return spook::fmod(x, y); }, [](long double x, long double y) { return std::fmod(x, y); });
+		binary("remainder", { -1.0e6, 1.0e6 }, { 1.0e-3, 1.0e3 }, inf, inf, [](auto x, auto y) { return spook::remainder(x, y); }, [](long double x, long double y) { return std::remainder(x, y); });
+
+		unary("sin", { -pi, pi }, 1.0, 1.0, [](auto x) { return spook::sin(x); }, [](long double x) { return std::sin(x); });
+		unary("sin", { -1.0e300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::sin(x); }, [](long double x) { return std::sin(x); });
+		unary("cos", { -pi, pi }, 1.0, 1.0, [](auto x) { return spook::cos(x); }, [](long double x) { return std::cos(x); });
+		unary("cos", { -1.0e300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::cos(x); }, [](long double x) { return std::cos(x); });
+		unary("tan", { -pi, pi }, 3.0, 3.0, [](auto x) { return spook::tan(x); }, [](long double x) { return std::tan(x); });
+		unary("tan", { -1.0e300, 1.0e300 }, 3.0, 3.0, [](auto x) { return spook::tan(x); }, [](long double x) { return std::tan(x); });
+
+		unary("asin", { -1.0, 1.0 }, 1.0, 1.0, [](auto x) { return spook::asin(x); }, [](long double x) { return std::asin(x); });
+		unary("acos", { -1.0, 1.0 }, 1.0, 1.0, [](auto x) { return spook::acos(x); }, [](long double x) { return std::acos(x); });
+		unary("atan", { -16.0, 16.0 }, 1.0, 1.0, [](auto x) { return spook::atan(x); }, [](long double x) { return std::atan(x); });
+		unary("atan", { -1.0e300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::atan(x); }, [](long double x) { return std::atan(x); });
+		binary("atan2", { -16.0, 16.0 }, { 1.0, 16.0 }, 1.0, 1.0, [](auto y, auto x) { return spook::atan2(y, x); }, [](long double y, long double x) { return std::atan2(y, x); });
+		binary("atan2", { 1.0e-30, 1.0e30 }, { -1.0e30, 1.0e30 }, 1.0, 1.0, [](auto y, auto x) { return spook::atan2(y, x); }, [](long double y, long double x) { return std::atan2(y, x); });
+
+		unary("exp", { -87.0, 88.0 }, 1.0, 1.0, [](auto x) { return spook::exp(x); }, [](long double x) { return std::exp(x); });
+		unary("exp", { -1.0e3, 1.0e3 }, 1.0, 1.0, [](auto x) { return spook::exp(x); }, [](long double x) { return std::exp(x); });
+		unary("exp2", { -1.2e3, 1.2e3 }, 1.0, 1.0, [](auto x) { return spook::exp2(x); }, [](long double x) { return std::exp2(x); });
+		unary("exp10", { -350.0, 350.0 }, 1.0, 1.0, [](auto x) { return spook::exp10(x); }, [](long double x) { return std::pow(10.0L, x); });
+		unary("expm1", { -1.0e3, 1.0e3 }, 1.5, 1.5, [](auto x) { return spook::expm1(x); }, [](long double x) { return std::expm1(x); });
+		unary("log", { 1.0 / 64.0, 64.0 }, 1.0, 1.0, [](auto x) { return spook::log(x); }, [](long double x) { return std::log(x); });
+		unary("log", { 1.0e-300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::log(x); }, [](long double x) { return std::log(x); });
+		unary("log2", { 1.0e-300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::log2(x); }, [](long double x) { return std::log2(x); });
+		unary("log10", { 1.0e-300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::log10(x); }, [](long double x) { return std::log10(x); });
+		unary("log1p", { -0.999, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::log1p(x); }, [](long double x) { return std::log1p(x); });
+		unary("sinh", { -720.0, 720.0 }, 1.0, 1.0, [](auto x) { return spook::sinh(x); }, [](long double x) { return std::sinh(x); });
+		unary("cosh", { -720.0, 720.0 }, 1.0, 1.0, [](auto x) { return spook::cosh(x); }, [](long double x) { return std::cosh(x); });
+		unary("tanh", { -20.0, 20.0 }, 1.0, 1.0, [](auto x) { return spook::tanh(x); }, [](long double x) { return std::tanh(x); });
+		unary("asinh", { -1.0e300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::asinh(x); }, [](long double x) { return std::asinh(x); });
+		unary("acosh", { 1.0, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::acosh(x); }, [](long double x) { return std::acosh(x); });
+		unary("atanh", { -1.0, 1.0 }, 1.0, 1.0, [](auto x) { return spook::atanh(x); }, [](long double x) { return std::atanh(x); });
+		unary("erf", { -6.0, 6.0 }, 1.0, 1.0, [](auto x) { return spook::erf(x); }, [](long double x) { return std::erf(x); });
+		unary("erfc", { -6.0, 27.0 }, 2.5, 2.0, [](auto x) { return spook::erfc(x); }, [](long double x) { return std::erfc(x); });
+		unary("tgamma", { 1.0e-3, 170.0 }, 1.0, 1.0, [](auto x) { return spook::tgamma(x); }, [](long double x) { return std::tgamma(x); });
+		unary("tgamma", { -170.0, -1.0e-3 }, 1.5, 1.5, [](auto x) { return spook::tgamma(x); }, [](long double x) { return std::tgamma(x); });
+		unary("lgamma", { 1.0e-3, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::lgamma(x); }, [](long double x) { return std::lgamma(x); });
+		//(-8, -2)にあるlog|Γ(x)|の零点の近傍は、相対誤差が保証されない
+		unary("lgamma", { -1.0e3, -8.0 }, 1.0, 1.0, [](auto x) { return spook::lgamma(x); }, [](long double x) { return std::lgamma(x); });
+		unary("lgamma", { -2.0, -1.0e-3 }, 1.5, 1.5, [](auto x) { return spook::lgamma(x); }, [](long double x) { return std::lgamma(x); });
+		binary("pow", { 1.0 / 64.0, 64.0 }, { -8.0, 8.0 }, 2.0, 2.0, [](auto x, auto y) { return spook::pow(x, y); }, [](long double x, long double y) { return std::pow(x, y); });
+
+		unary("sqrt", { 0.0, 1.0e300 }, 0.5, 0.5, [](auto x) { return spook::sqrt(x); }, [](long double x) { return std::sqrt(x); });
+		unary("cbrt", { 0.0, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::cbrt(x); }, [](long double x) { return std::cbrt(x); });
+		unary("rsqrt", { 1.0e-300, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::rsqrt(x); }, [](long double x) { return 1.0L / std::sqrt(x); });
+		unary("n_root<5>", { 0.0, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::n_root<5>(x); }, [](long double x) { return std::pow(x, 1.0L / 5.0L); });
+		binary("hypot", { -1.0e300, 1.0e300 }, { -1.0e300, 1.0e300 }, 1.0, 1.0, [](auto x, auto y) { return spook::hypot(x, y); }, [](long double x, long double y) { return std::hypot(x, y); });
+		binary("hypot", { -1.0e30, 1.0e30 }, { -1.0e30, 1.0e30 }, 1.0, 1.0, [](auto x, auto y) { return spook::hypot(x, y); }, [](long double x, long double y) { return std::hypot(x, y); });
+		binary("hypot", { -1.0e-300, 1.0e-300 }, { -1.0e-300, 1.0e-300 }, 1.0, 1.0, [](auto x, auto y) { return spook::hypot(x, y); }, [](long double x, long double y) { return std::hypot(x, y); });
+		binary("rnorm", { -1.0e300, 1.0e300 }, { -1.0e300, 1.0e300 }, 1.0, 1.0, [](auto x, auto y) { return spook::rnorm(std::array{ x, y }); }, [](long double x, long double y) { return 1.0L / std::hypot(x, y); });
+
+		//精度の方針を指定したもの、fast_tの予算はfloatが12ビット相当（2^12ulp）、doubleが単精度相当
+		unary("sin/fast", { -1.0e300, 1.0e300 }, 4096.0, 6.0e7, [](auto x) { return spook::sin(x, spook::fast); }, [](long double x) { return std::sin(x); });
+		unary("cos/fast", { -1.0e300, 1.0e300 }, 4096.0, 6.0e7, [](auto x) { return spook::cos(x, spook::fast); }, [](long double x) { return std::cos(x); });
+		unary("tan/fast", { -pi, pi }, 4096.0, 6.0e7, [](auto x) { return spook::tan(x, spook::fast); }, [](long double x) { return std::tan(x); });
+		unary("exp/fast", { -1.0e3, 1.0e3 }, 4096.0, 1.0e7, [](auto x) { return spook::exp(x, spook::fast); }, [](long double x) { return std::exp(x); });
+		unary("exp2/fast", { -1.2e3, 1.2e3 }, 4096.0, 1.0e7, [](auto x) { return spook::exp2(x, spook::fast); }, [](long double x) { return std::exp2(x); });
+		unary("exp10/fast", { -350.0, 350.0 }, 4096.0, 1.0e7, [](auto x) { return spook::exp10(x, spook::fast); }, [](long double x) { return std::pow(10.0L, x); });
+		unary("log/fast", { 1.0e-300, 1.0e300 }, 4096.0, 1.0e5, [](auto x) { return spook::log(x, spook::fast); }, [](long double x) { return std::log(x); });
+		unary("log2/fast", { 1.0e-300, 1.0e300 }, 4096.0, 1.0e5, [](auto x) { return spook::log2(x, spook::fast); }, [](long double x) { return std::log2(x); });
+		unary("log10/fast", { 1.0e-300, 1.0e300 }, 4096.0, 1.0e5, [](auto x) { return spook::log10(x, spook::fast); }, [](long double x) { return std::log10(x); });
+		binary("pow/fast", { 1.0 / 64.0, 64.0 }, { -8.0, 8.0 }, 4096.0, 1.0e7, [](auto x, auto y) { return spook::pow(x, y, spook::fast); }, [](long double x, long double y) { return std::pow(x, y); });
+		unary("sqrt/fast", { 0.0, 1.0e300 }, 4096.0, 4096.0, [](auto x) { return spook::sqrt(x, spook::fast); }, [](long double x) { return std::sqrt(x); });
+		unary("cbrt/fast", { 0.0, 1.0e300 }, 1.0, 1.0, [](auto x) { return spook::cbrt(x, spook::fast); }, [](long double x) { return std::cbrt(x); });
+		unary("rsqrt/fast", { 1.0e-300, 1.0e300 }, 4096.0, 4096.0, [](auto x) { return spook::rsqrt(x, spook::fast); }, [](long double x) { return 1.0L / std::sqrt(x); });
+
+		//実行時に<cmath>へ振り分けられる関数の、定数式での実装
+		{
+			constexpr domain wide{ -1.0e300, 1.0e300 }, integral{ -size_max, size_max }, positive{ 0.0, 1.0e300 };
+			constexpr domain dividend{ -1.0e6, 1.0e6 }, divisor{ 1.0e-3, 1.0e3 };
+			constexpr auto fabs = [](auto x) { return spook::fabs(x); };
+			constexpr auto floor = [](auto x) { return spook::floor(x); };
+			constexpr auto ceil = [](auto x) { return spook::ceil(x); };
+			constexpr auto trunc = [](auto x) { return spook::trunc(x); };
+			constexpr auto sqrt = [](auto x) { return spook::sqrt(x); };
+			constexpr auto fmod = [](auto x, auto y) { return spook::fmod(x, y); };
+			constexpr auto remainder = [](auto x, auto y) { return spook::remainder(x, y); };
+
+			constexpr auto fabs_f = constexpr_unary_results<float>(wide, fabs);
+			constexpr auto fabs_d = constexpr_unary_results<double>(wide, fabs);
+			constexpr auto floor_f = constexpr_unary_results<float>(integral, floor);
+			constexpr auto floor_d = constexpr_unary_results<double>(integral, floor);
+			constexpr auto ceil_f = constexpr_unary_results<float>(integral, ceil);
+			constexpr auto ceil_d = constexpr_unary_results<double>(integral, ceil);
+			constexpr auto trunc_f = constexpr_unary_results<float>(integral, trunc);
+			constexpr auto trunc_d = constexpr_unary_results<double>(integral, trunc);
+			constexpr auto sqrt_f = constexpr_unary_results<float>(positive, sqrt);
+			constexpr auto sqrt_d = constexpr_unary_results<double>(positive, sqrt);
+			constexpr auto fmod_f = constexpr_binary_results<float>(dividend, divisor, fmod);
+			constexpr auto fmod_d = constexpr_binary_results<double>(dividend, divisor, fmod);
+			constexpr auto remainder_f = constexpr_binary_results<float>(dividend, divisor, remainder);
+			constexpr auto remainder_d = constexpr_binary_results<double>(dividend, divisor, remainder);
+
+			constexpr_unary("fabs/constexpr", wide, 0.0, fabs_f, fabs_d, [](long double x) { return std::fabs(x); });
+			constexpr_unary("floor/constexpr", integral, 0.0, floor_f, floor_d, [](long double x) { return std::floor(x); });
+			constexpr_unary("ceil/constexpr", integral, 0.0, ceil_f, ceil_d, [](long double x) { return std::ceil(x); });
+			constexpr_unary("trunc/constexpr", integral, 0.0, trunc_f, trunc_d, [](long double x) { return std::trunc(x); });
+			constexpr_unary("sqrt/constexpr", positive, 0.5, sqrt_f, sqrt_d, [](long double x) { return std::sqrt(x); });
+			constexpr_binary("fmod/constexpr", dividend, divisor, 0.0, fmod_f, fmod_d, [](long double x, long double y) { return std::fmod(x, y); });
+			constexpr_binary("remainder/constexpr", dividend, divisor, 0.0, remainder_f, remainder_d, [](long double x, long double y) { return std::remainder(x, y); });
+		}
+
+		//correctly_rounded_tはfloatでは正しく丸めるので、参照値をfloatに丸めた値との一致を求める（予算0.5）
+		//doubleはほぼ正しい丸めで、参照のlong doubleの精度も11bitしか広くないので、その分だけ0.5より大きい
+		//dd<double>は2^-969を下回ると下位の桁が落ちるので、expは結果がそれより大きい範囲
+		unary("sin/correctly_rounded", { -1.0e300, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::sin(x, spook::correctly_rounded); }, [](long double x) { return std::sin(x); });
+		unary("cos/correctly_rounded", { -1.0e300, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::cos(x, spook::correctly_rounded); }, [](long double x) { return std::cos(x); });
+		unary("tan/correctly_rounded", { -pi, pi }, 0.5, 0.501, [](auto x) { return spook::tan(x, spook::correctly_rounded); }, [](long double x) { return std::tan(x); });
+		unary("exp/correctly_rounded", { -665.0, 709.0 }, 0.5, 0.501, [](auto x) { return spook::exp(x, spook::correctly_rounded); }, [](long double x) { return std::exp(x); });
+		unary("exp2/correctly_rounded", { -960.0, 1023.0 }, 0.5, 0.501, [](auto x) { return spook::exp2(x, spook::correctly_rounded); }, [](long double x) { return std::exp2(x); });
+		unary("exp10/correctly_rounded", { -289.0, 308.0 }, 0.5, 0.501, [](auto x) { return spook::exp10(x, spook::correctly_rounded); }, [](long double x) { return std::pow(10.0L, x); });
+		unary("log/correctly_rounded", { 1.0e-300, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::log(x, spook::correctly_rounded); }, [](long double x) { return std::log(x); });
+		unary("log2/correctly_rounded", { 1.0e-300, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::log2(x, spook::correctly_rounded); }, [](long double x) { return std::log2(x); });
+		unary("log10/correctly_rounded", { 1.0e-300, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::log10(x, spook::correctly_rounded); }, [](long double x) { return std::log10(x); });
+		binary("pow/correctly_rounded", { 1.0 / 64.0, 64.0 }, { -8.0, 8.0 }, 0.5, 0.501, [](auto x, auto y) { return spook::pow(x, y, spook::correctly_rounded); }, [](long double x, long double y) { return std::pow(x, y); });
+		unary("cbrt/correctly_rounded", { 0.0, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::cbrt(x, spook::correctly_rounded); }, [](long double x) { return std::cbrt(x); });
+		unary("rsqrt/correctly_rounded", { 1.0e-300, 1.0e300 }, 0.5, 0.501, [](auto x) { return spook::rsqrt(x, spook::correctly_rounded); }, [](long double x) { return 1.0L / std::sqrt(x); });
+	}
+
+	inline void parse_args(int argc, char* argv[]) {
+		for (int i = 1; i < argc; ++i) {
+			const std::string arg = argv[i];
+			const auto value = [&](const char* key) -> const char* {
+				const auto len = std::strlen(key);
+				return arg.compare(0, len, key) == 0 ? argv[i] + len : nullptr;
+			};
+
+			if (auto v = value("--filter=")) {
+				opt.filter = v;
+			} else if (auto v = value("--float-stride=")) {
+				opt.float_stride = (std::max)(std::uint64_t(1), std::uint64_t(std::strtoull(v, nullptr, 10)));
+			} else if (auto v = value("--double-samples=")) {
+				opt.double_samples = std::strtoull(v, nullptr, 10);
+			} else if (auto v = value("--threads=")) {
+				opt.threads = (std::max)(1u, unsigned(std::strtoul(v, nullptr, 10)));
+			} else {
+				std::fprintf(stderr, "usage: %s [--filter=SUBSTR] [--float-stride=N] [--double-samples=N] [--threads=N]\n", argv[0]);
+				std::exit(EXIT_FAILURE);
+			}
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	using namespace spook_ulp;
+
+	parse_args(argc, argv);
+
+	std::printf("%-18s %-6s %-34s %12s %12s %10s %8s %10s\n", "function", "type", "domain", "inputs", "max[ulp]", "mean[ulp]", "mismatch", "budget");
+
+	run();
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -171,6 +171,100 @@ namespace spook_test::bit {
 		CHECK_EQ(64u, spook::log2p1(0xFF043802abcf9328u));
 	}
 
+	namespace {
+
+		inline constexpr std::uint64_t intrinsic_inputs[] = {1ull, 2ull, 3ull, 0x80ull, 0xFFull, 0x100ull, 0x8001ull, 0xF0F0F0F0ull, 0x80000000ull, 0x80000001ull, 0x0800000000000001ull, 0xFF043802abcf9328ull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull};
+
+		//定数式で計算した結果を並べる
+		template<typename T>
+		constexpr auto portable_results() {
+			std::array<std::array<int, 7>, std::size(intrinsic_inputs)> results{};
+
+			for (std::size_t i = 0; i < std::size(intrinsic_inputs); ++i) {
+				const T x = T(intrinsic_inputs[i]);
+				results[i] = { spook::msb_pos(x), spook::lsb_pos(x), spook::popcount(x), spook::countr_zero(x), spook::countl_zero(x), int(spook::floor2(x) == T(0) ? -1 : spook::countr_zero(spook::floor2(x))), int(spook::ceil2(x) == T(0) ? -1 : spook::countr_zero(spook::ceil2(x))) };
+			}
+
+			return results;
+		}
+
+		template<typename T>
+		void check_intrinsic_results() {
+			constexpr auto expected = portable_results<T>();
+
+			for (std::size_t i = 0; i < std::size(intrinsic_inputs); ++i) {
+				const T x = T(intrinsic_inputs[i]);
+				const auto& e = expected[i];
+
+				CHECK_EQ(e[0], spook::msb_pos(x));
+				CHECK_EQ(e[1], spook::lsb_pos(x));
+				CHECK_EQ(e[2], spook::popcount(x));
+				CHECK_EQ(e[3], spook::countr_zero(x));
+				CHECK_EQ(e[4], spook::countl_zero(x));
+				CHECK_EQ(e[5], (spook::floor2(x) == T(0)) ? -1 : spook::countr_zero(spook::floor2(x)));
+				CHECK_EQ(e[6], (spook::ceil2(x) == T(0)) ? -1 : spook::countr_zero(spook::ceil2(x)));
+			}
+		}
+	}
+
+	TEST_CASE("runtime intrinsic test") {
+		//実行時のビット命令による結果と、定数式での結果が一致する
+		check_intrinsic_results<unsigned char>();
+		check_intrinsic_results<unsigned short>();
+		check_intrinsic_results<unsigned int>();
+		check_intrinsic_results<unsigned long>();
+		check_intrinsic_results<unsigned long long>();
+	}
+
+#if defined(__GNUC__) && defined(__cpp_lib_bit_cast)
+
+	namespace {
+
+		template<typename T>
+		void check_simd_results() {
+			using simd = spook::simd<T>;
+			constexpr std::size_t N = simd::size();
+
+			for (std::size_t first = 0; first < std::size(intrinsic_inputs); first += N) {
+				T in[N] = {};
+				for (std::size_t i = 0; i < N; ++i) {
+					in[i] = T(intrinsic_inputs[(first + i) % std::size(intrinsic_inputs)]);
+				}
+				//0も混ぜる
+				in[N - 1] = T(0);
+
+				const simd x = simd::load(in);
+				const simd pc = spook::popcount(x);
+				const simd lz = spook::countl_zero(x);
+				const simd tz = spook::countr_zero(x);
+				const simd lo = spook::countl_one(x);
+				const simd to = spook::countr_one(x);
+				const simd rl = spook::rotl(x, 3);
+				const simd rr = spook::rotr(x, 3);
+
+				for (std::size_t i = 0; i < N; ++i) {
+					CHECK_EQ(T(spook::popcount(in[i])), pc[i]);
+					CHECK_EQ(T(spook::countl_zero(in[i])), lz[i]);
+					CHECK_EQ(T(spook::countr_zero(in[i])), tz[i]);
+					CHECK_EQ(T(spook::countl_one(in[i])), lo[i]);
+					CHECK_EQ(T(spook::countr_one(in[i])), to[i]);
+					CHECK_EQ(spook::rotl(in[i], 3), rl[i]);
+					CHECK_EQ(spook::rotr(in[i], 3), rr[i]);
+				}
+			}
+		}
+	}
+
+	TEST_CASE("simd bit test") {
+		//各要素の結果はスカラー版と一致する
+		check_simd_results<unsigned char>();
+		check_simd_results<unsigned short>();
+		check_simd_results<unsigned int>();
+		check_simd_results<unsigned long long>();
+	}
+
+#endif // __GNUC__
+
 	TEST_CASE("pow2 test") {
 		CHECK_EQ(1, spook::pow2(0));
 		CHECK_EQ(2, spook::pow2(1));
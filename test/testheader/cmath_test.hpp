@@ -1,6 +1,8 @@
-#include "doctest/doctest.h"
+﻿#include "doctest/doctest.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "spook.hpp"
 
@@ -287,6 +289,36 @@ namespace spook_test::cmath {
 		}
 	}
 
+	TEST_CASE("fmod remainder exactness test") {
+		//定数式の結果は丸め誤差が無く、実行時の標準ライブラリと一致する
+		constexpr std::pair<double, double> args[] = {
+			{ 3.14, 3.0 }, { 6.3, 3.15 }, { -6.3, 3.0 }, { 6.3, -3.0 }, { 5.0, 2.0 }, { 7.0, 2.0 }, { -5.0, 2.0 }, { -4.0, 2.0 },
+			{ 1.0E300, 3.0 }, { 1.0E300, 0.1 }, { -1.0E300, 7.0E-300 }, { 1.0E-310, 3.0E-320 }, { 5.0E-324, 1.0E300 },
+			{ 1.7976931348623157E308, 1.0E308 }, { 1.0E308, 1.7976931348623157E308 }, { 0.75, 0.5 }, { 1.25, 0.5 }, { 12345.678, 1.0E-5 }
+		};
+		constexpr std::size_t N = std::size(args);
+
+		constexpr auto results = [&] {
+			std::array<std::pair<double, double>, N> r{};
+			for (std::size_t i = 0; i < N; ++i) r[i] = { spook::fmod(args[i].first, args[i].second), spook::remainder(args[i].first, args[i].second) };
+			return r;
+		}();
+
+		for (std::size_t i = 0; i < N; ++i) {
+			const double fm = std::fmod(args[i].first, args[i].second);
+			const double rem = std::remainder(args[i].first, args[i].second);
+
+			CHECK_EQ(fm, results[i].first);
+			CHECK_EQ(std::signbit(fm), std::signbit(results[i].first));
+			CHECK_EQ(rem, results[i].second);
+			CHECK_EQ(std::signbit(rem), std::signbit(results[i].second));
+		}
+
+		static_assert(spook::fmod(1.0E22, 3.0) == 1.0);
+		static_assert(spook::remainder(7.0f, 2.0f) == -1.0f);
+		static_assert(spook::remainder(1.0, std::numeric_limits<double>::infinity()) == 1.0);
+	}
+
 	TEST_CASE("sin test") {
 		using namespace spook::constant;
 		constexpr double eps = 1.0E-15;
@@ -460,6 +492,108 @@ namespace spook_test::cmath {
 		}
 	}
 
+	TEST_CASE("sincos test") {
+		constexpr double eps = 1.0E-15;
+
+		for (double x : { 0.0, 0.5, -1.0, 2.0, 3.0, -4.5, 6.0, 1.0E22 }) {
+			const auto [sin_v, cos_v] = spook::sincos(x);
+
+			CHECK_EQ(doctest::Approx(std::sin(x)).epsilon(eps), sin_v);
+			CHECK_EQ(doctest::Approx(std::cos(x)).epsilon(eps), cos_v);
+		}
+
+		{
+			constexpr auto sc = spook::sincos(2.0);
+
+			CHECK_EQ(spook::sin(2.0), sc.first);
+			CHECK_EQ(spook::cos(2.0), sc.second);
+		}
+
+		{
+			constexpr auto sc = spook::sincos(-0.0);
+
+			CHECK_UNARY(std::signbit(sc.first));
+			CHECK_EQ(1.0, sc.second);
+		}
+	}
+
+	TEST_CASE("sin cos kernel test") {
+		//float, long doubleそれぞれの係数で計算される
+		{
+			constexpr float x = 0.7f;
+			constexpr auto sin_v = spook::sin(x);
+			constexpr auto cos_v = spook::cos(x);
+
+			CHECK_EQ(doctest::Approx(std::sin(x)).epsilon(1.0E-7), sin_v);
+			CHECK_EQ(doctest::Approx(std::cos(x)).epsilon(1.0E-7), cos_v);
+		}
+
+		{
+			constexpr long double x = 2.5L;
+			constexpr auto sin_v = spook::sin(x);
+			constexpr auto cos_v = spook::cos(x);
+
+			CHECK_EQ(doctest::Approx(double(std::sin(x))).epsilon(1.0E-15), double(sin_v));
+			CHECK_EQ(doctest::Approx(double(std::cos(x))).epsilon(1.0E-15), double(cos_v));
+		}
+
+		//下位の値を持たない小さな引数
+		{
+			constexpr double x = 1.0E-200;
+
+			CHECK_EQ(x, spook::sin(x));
+			CHECK_EQ(1.0, spook::cos(x));
+		}
+	}
+
+	TEST_CASE("trigonometric argument reduction test") {
+		constexpr double eps = 1.0E-15;
+
+		//Cody-Waiteの範囲
+		{
+			constexpr double x = 12345.678;
+
+			CHECK_EQ(doctest::Approx(std::sin(x)).epsilon(eps), spook::sin(x));
+			CHECK_EQ(doctest::Approx(std::cos(x)).epsilon(eps), spook::cos(x));
+			CHECK_EQ(doctest::Approx(std::tan(x)).epsilon(eps), spook::tan(x));
+		}
+
+		//Payne-Hanekの範囲
+		{
+			constexpr double x = 1.0E22;
+			constexpr auto sin_v = spook::sin(x);
+			constexpr auto cos_v = spook::cos(x);
+
+			CHECK_EQ(doctest::Approx(std::sin(x)).epsilon(eps), sin_v);
+			CHECK_EQ(doctest::Approx(std::cos(x)).epsilon(eps), cos_v);
+		}
+
+		{
+			constexpr double x = -1.0E300;
+			constexpr auto sin_v = spook::sin(x);
+			constexpr auto cos_v = spook::cos(x);
+
+			CHECK_EQ(doctest::Approx(std::sin(x)).epsilon(eps), sin_v);
+			CHECK_EQ(doctest::Approx(std::cos(x)).epsilon(eps), cos_v);
+		}
+
+		//pi/2の倍数に非常に近い値
+		{
+			constexpr double x = 6381956970095103.0 * 0x1p797;
+			constexpr auto cos_v = spook::cos(x);
+
+			//cos(x)は1e-19程度なので相対誤差で比べる
+			CHECK_EQ(doctest::Approx(1.0).epsilon(eps), cos_v / std::cos(x));
+		}
+
+		{
+			constexpr float x = 1.0E30f;
+			constexpr auto sin_v = spook::sin(x);
+
+			CHECK_EQ(doctest::Approx(std::sin(x)).epsilon(1.0E-6), sin_v);
+		}
+	}
+
 	TEST_CASE("atan test") {
 		constexpr double eps = 1.0E-15;
 
@@ -592,6 +726,222 @@ namespace spook_test::cmath {
 
 			CHECK_EQ(doctest::Approx(expected).epsilon(eps), calc);
 		}
+
+		//|y/x|が極端な場合
+		for (double x : { 1.0E-300, 1.0E-10, 3.0, 1.0E10, 1.0E300 }) {
+			for (double y : { 1.0E-300, 1.0, 1.0E300 }) {
+				CHECK_EQ(doctest::Approx(std::atan2(y, x)).epsilon(eps), spook::atan2(y, x));
+				CHECK_EQ(doctest::Approx(std::atan2(-y, -x)).epsilon(eps), spook::atan2(-y, -x));
+			}
+		}
+
+		for (double x : { 1.0E-300, 0.4, 2.0, 1.0E16, 1.0E300 }) {
+			CHECK_EQ(doctest::Approx(std::atan(x)).epsilon(eps), spook::atan(x));
+			CHECK_EQ(doctest::Approx(std::atan(-x)).epsilon(eps), spook::atan(-x));
+		}
+
+		CHECK_EQ(doctest::Approx(std::atan(0.5f)).epsilon(1.0E-6), spook::atan(0.5f));
+		CHECK_EQ(doctest::Approx(std::atan2(3.0L, -4.0L)).epsilon(1.0E-18), spook::atan2(3.0L, -4.0L));
+
+		{
+			constexpr auto calc = spook::atan(1.0E300);
+			CHECK_EQ(doctest::Approx(std::atan(1.0E300)).epsilon(eps), calc);
+		}
+	}
+
+	TEST_CASE("asin acos test") {
+		constexpr double eps = 1.0E-15;
+		constexpr double pi = 3.141592653589793;
+
+		for (double x : { 1.0E-300, 1.0E-9, 0.1, 0.5, 0.7, 0.9, 0.999, 1.0 - 1.0E-15, 1.0 }) {
+			for (double v : { x, -x }) {
+				CHECK_EQ(doctest::Approx(std::asin(v)).epsilon(eps), spook::asin(v));
+				CHECK_EQ(doctest::Approx(std::acos(v)).epsilon(eps), spook::acos(v));
+			}
+		}
+
+		CHECK_EQ(doctest::Approx(std::asin(0.3f)).epsilon(1.0E-6), spook::asin(0.3f));
+		CHECK_EQ(doctest::Approx(std::acos(-0.3L)).epsilon(1.0E-18), spook::acos(-0.3L));
+
+		//特殊な値
+		CHECK_EQ(pi / 2.0, spook::acos(0.0));
+		CHECK_EQ(pi, spook::acos(-1.0));
+		CHECK_EQ(0.0, spook::acos(1.0));
+		CHECK_EQ(-pi / 2.0, spook::asin(-1.0));
+		CHECK_UNARY(spook::isnan(spook::asin(1.5)));
+		CHECK_UNARY(spook::isnan(spook::acos(-1.5)));
+
+		{
+			constexpr auto calc = spook::asin(0.999);
+			CHECK_EQ(doctest::Approx(std::asin(0.999)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::acos(0.5);
+			CHECK_EQ(doctest::Approx(std::acos(0.5)).epsilon(eps), calc);
+		}
+	}
+
+	TEST_CASE("frexp ldexp test") {
+		constexpr auto inf = std::numeric_limits<double>::infinity();
+		constexpr auto denorm_min = std::numeric_limits<double>::denorm_min();
+		constexpr auto max = (std::numeric_limits<double>::max)();
+
+		for (double x : { 1.0, -3.0, 0.1, 1.0E300, -1.0E-310, denorm_min, max }) {
+			int e1 = 0, e2 = 0;
+			CHECK_EQ(std::frexp(x, &e2), spook::frexp(x, &e1));
+			CHECK_EQ(e2, e1);
+			CHECK_EQ(std::ilogb(x), spook::ilogb(x));
+			CHECK_EQ(std::logb(x), spook::logb(x));
+
+			for (int n : { -2000, -1074, -60, -1, 1, 60, 1023, 2000 }) {
+				CHECK_EQ(std::ldexp(x, n), spook::ldexp(x, n));
+				CHECK_EQ(std::scalbn(x, n), spook::scalbn(x, n));
+			}
+
+			CHECK_EQ(std::nextafter(x, inf), spook::nextafter(x, inf));
+			CHECK_EQ(std::nextafter(x, -inf), spook::nextafter(x, -inf));
+			CHECK_EQ(std::nextafter(x, 0.0), spook::nextafter(x, 0.0));
+		}
+
+		for (float x : { 1.0f, -0.75f, 1.0E-40f, 3.0E38f }) {
+			int e1 = 0, e2 = 0;
+			CHECK_EQ(std::frexp(x, &e2), spook::frexp(x, &e1));
+			CHECK_EQ(e2, e1);
+			CHECK_EQ(std::ldexp(x, -140), spook::ldexp(x, -140));
+			CHECK_EQ(std::nextafter(x, 0.0f), spook::nextafter(x, 0.0f));
+		}
+
+		for (long double x : { 1.0L, -3.0L, (std::numeric_limits<long double>::min)() / 3.0L, (std::numeric_limits<long double>::max)() / 3.0L }) {
+			int e1 = 0, e2 = 0;
+			CHECK_EQ(std::frexp(x, &e2), spook::frexp(x, &e1));
+			CHECK_EQ(e2, e1);
+			CHECK_EQ(std::ldexp(x, -100), spook::ldexp(x, -100));
+			CHECK_EQ(std::nextafter(x, 0.0L), spook::nextafter(x, 0.0L));
+		}
+
+		{
+			constexpr auto r = [] {
+				int e = 0;
+				const double m = spook::frexp(-1.0E-310, &e);
+				return std::pair{ m, e };
+			}();
+			int e = 0;
+			CHECK_EQ(std::frexp(-1.0E-310, &e), r.first);
+			CHECK_EQ(e, r.second);
+		}
+		{
+			//非正規化数への丸めは1度だけ
+			constexpr auto r = spook::ldexp(1.5, -1074);
+			CHECK_EQ(2.0 * denorm_min, r);
+		}
+		{
+			constexpr auto r = spook::ldexp(1.0, 1024);
+			CHECK_EQ(inf, r);
+		}
+		{
+			constexpr auto r = spook::nextafter(1.0, 0.0);
+			CHECK_EQ(1.0 - std::numeric_limits<double>::epsilon() / 2.0, r);
+		}
+		{
+			constexpr auto r = spook::ulp(1.0);
+			CHECK_EQ(std::numeric_limits<double>::epsilon(), r);
+		}
+
+		CHECK_EQ(denorm_min, spook::ulp(0.0));
+		CHECK_EQ(denorm_min, spook::ulp(-denorm_min));
+		CHECK_EQ(inf, spook::nextafter(max, inf));
+		CHECK_EQ(max, spook::nextafter(inf, 0.0));
+		CHECK_EQ(-denorm_min, spook::nextafter(0.0, -1.0));
+		CHECK_EQ(std::ilogb(0.0), spook::ilogb(0.0));
+		CHECK_EQ(-inf, spook::logb(0.0));
+		CHECK_UNARY(std::isnan(spook::nextafter(std::numeric_limits<double>::quiet_NaN(), 0.0)));
+	}
+
+	TEST_CASE("exp test") {
+		constexpr double eps = 1.0E-15;
+		constexpr auto inf = std::numeric_limits<double>::infinity();
+
+		for (double x : { -700.0, -10.5, -1.0, -1.0E-10, 0.5, 1.0, 2.0, 88.7, 709.5 }) {
+			CHECK_EQ(doctest::Approx(std::exp(x)).epsilon(eps), spook::exp(x));
+			CHECK_EQ(doctest::Approx(std::exp2(x)).epsilon(eps), spook::exp2(x));
+			CHECK_EQ(doctest::Approx(std::expm1(x)).epsilon(eps), spook::expm1(x));
+		}
+
+		for (double x : { -300.5, -2.0, 0.25, 3.0, 308.0 }) {
+			CHECK_EQ(doctest::Approx(std::pow(10.0, x)).epsilon(eps), spook::exp10(x));
+		}
+
+		{
+			constexpr auto r = spook::exp(1.0);
+			CHECK_EQ(std::exp(1.0), r);
+		}
+		{
+			constexpr auto r = spook::exp2(-1074.0);
+			CHECK_EQ(std::exp2(-1074.0), r);
+		}
+		{
+			constexpr auto r = spook::exp(-745.2);
+			CHECK_EQ(0.0, r);
+		}
+		{
+			constexpr auto r = spook::exp(710.0);
+			CHECK_EQ(inf, r);
+		}
+		{
+			constexpr auto r = spook::expm1(1.0E-300);
+			CHECK_EQ(1.0E-300, r);
+		}
+
+		CHECK_EQ(0.0, spook::exp(-inf));
+		CHECK_EQ(inf, spook::exp(inf));
+		CHECK_EQ(-1.0, spook::expm1(-inf));
+		CHECK_UNARY(std::isnan(spook::exp(std::numeric_limits<double>::quiet_NaN())));
+	}
+
+	TEST_CASE("log test") {
+		constexpr double eps = 1.0E-15;
+		constexpr auto inf = std::numeric_limits<double>::infinity();
+
+		for (double x : { 4.9E-324, 1.0E-300, 0.1, 0.75, 1.5, 2.0, 10.0, 1.0E10, 1.0E300, 1.7E308 }) {
+			CHECK_EQ(doctest::Approx(std::log(x)).epsilon(eps), spook::log(x));
+			CHECK_EQ(doctest::Approx(std::log2(x)).epsilon(eps), spook::log2(x));
+			CHECK_EQ(doctest::Approx(std::log10(x)).epsilon(eps), spook::log10(x));
+		}
+
+		for (double x : { -0.999999, -0.5, -1.0E-10, 1.0E-300, 0.25, 3.0, 1.0E300 }) {
+			CHECK_EQ(doctest::Approx(std::log1p(x)).epsilon(eps), spook::log1p(x));
+		}
+
+		{
+			constexpr auto r = spook::log(1.0E300);
+			CHECK_EQ(std::log(1.0E300), r);
+		}
+		{
+			constexpr auto r = spook::log(1.0E-300);
+			CHECK_EQ(std::log(1.0E-300), r);
+		}
+		{
+			constexpr auto r = spook::log2(0x1p-1074);
+			CHECK_EQ(-1074.0, r);
+		}
+		{
+			constexpr auto r = spook::log10(1000.0);
+			CHECK_EQ(3.0, r);
+		}
+		{
+			constexpr auto r = spook::log1p(1.0E-300);
+			CHECK_EQ(1.0E-300, r);
+		}
+
+		CHECK_EQ(0.0, spook::log(1.0));
+		CHECK_EQ(-inf, spook::log(0.0));
+		CHECK_EQ(inf, spook::log(inf));
+		CHECK_EQ(-inf, spook::log1p(-1.0));
+		CHECK_UNARY(std::isnan(spook::log(-1.0)));
+		CHECK_UNARY(std::isnan(spook::log2(-inf)));
+		CHECK_UNARY(std::isnan(spook::log1p(-2.0)));
+		CHECK_UNARY(std::isnan(spook::log10(std::numeric_limits<double>::quiet_NaN())));
 	}
 
 	TEST_CASE("float pow test")
@@ -818,6 +1168,889 @@ namespace spook_test::cmath {
 		}
 	}
 
+	TEST_CASE("rsqrt n_root test") {
+		//sqrtは正しく丸められる
+		for (double x : { 4.9406564584124654E-324, 1.0E-310, 2.0, 3.0, 1.0E300, (std::numeric_limits<double>::max)() }) {
+			CHECK_EQ(std::sqrt(x), spook::sqrt(x));
+		}
+		for (float x : { 1.4E-45f, 2.0f, 3.0f, (std::numeric_limits<float>::max)() }) {
+			CHECK_EQ(std::sqrt(x), spook::sqrt(x));
+		}
+
+		{
+			constexpr double inf = std::numeric_limits<double>::infinity();
+
+			CHECK_EQ(inf, spook::sqrt(inf));
+			CHECK_UNARY(spook::isnan(spook::sqrt(-1.0)));
+			CHECK_EQ(inf, spook::rsqrt(0.0));
+			CHECK_EQ(0.0, spook::rsqrt(inf));
+			CHECK_UNARY(spook::isnan(spook::rsqrt(-1.0)));
+			CHECK_UNARY(spook::isnan(spook::rsqrt(std::numeric_limits<double>::quiet_NaN())));
+		}
+
+		for (double x : { 4.0E-320, 0.5, 2.0, 3.0, 1.0E300 }) {
+			CHECK_EQ(doctest::Approx(1.0 / std::sqrt(x)).epsilon(1.0E-15), spook::rsqrt(x));
+			CHECK_EQ(doctest::Approx(std::cbrt(x)).epsilon(1.0E-15), spook::cbrt(x));
+			//0.2はちょうど1/5ではないので、long doubleで計算する
+			CHECK_EQ(doctest::Approx(double(std::pow(static_cast<long double>(x), 1.0L / 5.0L))).epsilon(1.0E-15), spook::n_root<5>(x));
+		}
+
+		{
+			constexpr auto calc = spook::rsqrt(4.0);
+			CHECK_EQ(0.5, calc);
+		}
+
+		{
+			constexpr auto calc = spook::n_root<5>(32.0);
+			CHECK_EQ(doctest::Approx(2.0).epsilon(1.0E-15), calc);
+		}
+
+		{
+			constexpr auto calc = spook::n_root<1>(3.0);
+			CHECK_EQ(3.0, calc);
+		}
+	}
+
+	TEST_CASE("hypot norm test") {
+		constexpr double inf = std::numeric_limits<double>::infinity();
+		constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+		{
+			constexpr auto calc = spook::hypot(3.0, 4.0);
+			CHECK_EQ(5.0, calc);
+		}
+
+		{
+			constexpr auto calc = spook::hypot(1.0, 2.0, 2.0);
+			CHECK_EQ(3.0, calc);
+		}
+
+		//途中でオーバーフロー、アンダーフローしない
+		for (auto [x, y] : { std::pair{ 1.0E300, 1.0E300 }, std::pair{ -1.5E-308, 2.0E-308 }, std::pair{ 1.0E300, 1.0E-300 }, std::pair{ 0.1, 0.2 } }) {
+			CHECK_EQ(doctest::Approx(std::hypot(x, y)).epsilon(1.0E-15), spook::hypot(x, y));
+			CHECK_EQ(doctest::Approx(1.0 / std::hypot(x, y)).epsilon(1.0E-15), spook::rnorm(std::array{ x, y }));
+		}
+		CHECK_EQ(doctest::Approx(std::hypot(1.0E300, 2.0E300, 3.0E300)).epsilon(1.0E-15), spook::hypot(1.0E300, 2.0E300, 3.0E300));
+		CHECK_EQ(doctest::Approx(std::hypot(3.0E30f, 4.0E30f)).epsilon(1.0E-6), spook::hypot(3.0E30f, 4.0E30f));
+
+		//どちらかが∞なら、もう片方がNaNでも∞
+		CHECK_EQ(inf, spook::hypot(inf, nan));
+		CHECK_EQ(inf, spook::hypot(nan, -inf));
+		CHECK_UNARY(spook::isnan(spook::hypot(nan, 1.0)));
+		CHECK_EQ(0.0, spook::hypot(0.0, -0.0));
+		CHECK_EQ(2.0, spook::hypot(-2.0, 0.0));
+
+		{
+			constexpr auto calc = spook::norm(std::array{ 1.0, 2.0, 4.0, 10.0 });
+			CHECK_EQ(11.0, calc);
+		}
+
+		{
+			constexpr auto calc = spook::rnorm(std::array{ 0.0, 3.0, 0.0, -4.0 });
+			CHECK_EQ(0.2, calc);
+		}
+
+		CHECK_EQ(0.0, spook::norm(std::array<double, 0>{}));
+		CHECK_EQ(inf, spook::rnorm(std::array{ 0.0, 0.0 }));
+		CHECK_EQ(0.0, spook::rnorm(std::array{ 1.0, -inf }));
+		CHECK_UNARY(spook::isnan(spook::rnorm(std::array{ 1.0, nan })));
+	}
+
+	TEST_CASE("hyperbolic test") {
+		constexpr double eps = 1.0E-15;
+		constexpr double inf = std::numeric_limits<double>::infinity();
+
+		for (double x : { 1.0E-300, 1.0E-10, 0.1, 0.3465, 1.0, 5.0, 19.0, 25.0, 700.0 }) {
+			for (double v : { x, -x }) {
+				CHECK_EQ(doctest::Approx(std::sinh(v)).epsilon(eps), spook::sinh(v));
+				CHECK_EQ(doctest::Approx(std::cosh(v)).epsilon(eps), spook::cosh(v));
+				CHECK_EQ(doctest::Approx(std::tanh(v)).epsilon(eps), spook::tanh(v));
+				CHECK_EQ(doctest::Approx(std::asinh(v)).epsilon(eps), spook::asinh(v));
+			}
+		}
+
+		for (double x : { 1.0 + 1.0E-15, 1.0 + 1.0E-9, 1.5, 2.0, 1.0E8, 1.0E300 }) {
+			CHECK_EQ(doctest::Approx(std::acosh(x)).epsilon(eps), spook::acosh(x));
+		}
+
+		for (double x : { 1.0E-300, 1.0E-10, 0.1, 0.5, 0.9, 1.0 - 1.0E-15 }) {
+			CHECK_EQ(doctest::Approx(std::atanh(x)).epsilon(eps), spook::atanh(x));
+			CHECK_EQ(doctest::Approx(std::atanh(-x)).epsilon(eps), spook::atanh(-x));
+		}
+
+		CHECK_EQ(doctest::Approx(std::tanh(0.5f)).epsilon(1.0E-6), spook::tanh(0.5f));
+		CHECK_EQ(doctest::Approx(std::sinh(0.5L)).epsilon(1.0E-18), spook::sinh(0.5L));
+
+		//特殊な値
+		CHECK_EQ(inf, spook::sinh(711.0));
+		CHECK_EQ(-inf, spook::sinh(-inf));
+		CHECK_EQ(inf, spook::cosh(-inf));
+		CHECK_EQ(1.0, spook::cosh(-0.0));
+		CHECK_EQ(-1.0, spook::tanh(-inf));
+		CHECK_EQ(1.0, spook::tanh(30.0));
+		CHECK_UNARY(std::signbit(spook::tanh(-0.0)));
+		CHECK_EQ(inf, spook::asinh(inf));
+		CHECK_EQ(0.0, spook::acosh(1.0));
+		CHECK_UNARY(spook::isnan(spook::acosh(0.5)));
+		CHECK_EQ(-inf, spook::atanh(-1.0));
+		CHECK_UNARY(spook::isnan(spook::atanh(1.5)));
+
+		{
+			constexpr auto calc = spook::tanh(0.5);
+			CHECK_EQ(doctest::Approx(std::tanh(0.5)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::acosh(2.0);
+			CHECK_EQ(doctest::Approx(std::acosh(2.0)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::atanh(-0.5);
+			CHECK_EQ(doctest::Approx(std::atanh(-0.5)).epsilon(eps), calc);
+		}
+	}
+
+	TEST_CASE("erf erfc test") {
+		constexpr double eps = 1.0E-15;
+		constexpr double inf = std::numeric_limits<double>::infinity();
+
+		for (double x : { 1.0E-300, 1.0E-9, 0.1, 0.4999, 0.5, 0.75, 0.99, 1.0, 1.5, 2.0, 3.7, 4.0, 5.9 }) {
+			for (double v : { x, -x }) {
+				CHECK_EQ(doctest::Approx(std::erf(v)).epsilon(eps), spook::erf(v));
+				CHECK_EQ(doctest::Approx(std::erfc(v)).epsilon(eps), spook::erfc(v));
+			}
+		}
+
+		//erfcは減衰しても相対誤差が保たれる
+		for (double x : { 6.0, 10.0, 15.5, 26.0, 27.2 }) {
+			CHECK_EQ(doctest::Approx(std::erfc(x)).epsilon(eps), spook::erfc(x));
+		}
+
+		CHECK_EQ(doctest::Approx(std::erf(0.3f)).epsilon(1.0E-6), spook::erf(0.3f));
+		CHECK_EQ(doctest::Approx(std::erfc(9.0f)).epsilon(1.0E-6), spook::erfc(9.0f));
+		CHECK_EQ(doctest::Approx(std::erf(0.7L)).epsilon(1.0E-18), spook::erf(0.7L));
+		CHECK_EQ(doctest::Approx(std::erfc(30.0L)).epsilon(1.0E-18), spook::erfc(30.0L));
+
+		//特殊な値
+		CHECK_EQ(1.0, spook::erf(inf));
+		CHECK_EQ(-1.0, spook::erf(-inf));
+		CHECK_EQ(1.0, spook::erf(6.0));
+		CHECK_UNARY(std::signbit(spook::erf(-0.0)));
+		CHECK_EQ(0.0, spook::erfc(inf));
+		CHECK_EQ(2.0, spook::erfc(-inf));
+		CHECK_EQ(1.0, spook::erfc(0.0));
+		CHECK_EQ(0.0, spook::erfc(30.0));
+		CHECK_UNARY(spook::isnan(spook::erf(std::numeric_limits<double>::quiet_NaN())));
+
+		{
+			constexpr auto calc = spook::erf(0.8);
+			CHECK_EQ(doctest::Approx(std::erf(0.8)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::erfc(-1.25);
+			CHECK_EQ(doctest::Approx(std::erfc(-1.25)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::erfc(12.0);
+			CHECK_EQ(doctest::Approx(std::erfc(12.0)).epsilon(eps), calc);
+		}
+	}
+
+	TEST_CASE("gamma test") {
+		constexpr double eps = 1.0E-15;
+		constexpr double inf = std::numeric_limits<double>::infinity();
+
+		for (double x : { 1.0E-300, 1.0E-9, 0.1, 0.5, 0.8, 1.3, 1.9, 2.6, 3.5, 10.1, 13.9, 14.2, 50.5, 171.5 }) {
+			CHECK_EQ(doctest::Approx(std::tgamma(x)).epsilon(eps), spook::tgamma(x));
+			CHECK_EQ(doctest::Approx(std::lgamma(x)).epsilon(eps), spook::lgamma(x));
+		}
+
+		for (double x : { 1.0E-9, 0.1, 0.5, 1.3, 9.9, 20.5, 100.7, 170.2 }) {
+			CHECK_EQ(doctest::Approx(std::tgamma(-x)).epsilon(eps), spook::tgamma(-x));
+		}
+
+		for (double x : { 1.0E-300, 0.3, 0.5, 1.3, 8.5, 20.5, 1000.7, 1.0E15 + 0.5 }) {
+			CHECK_EQ(doctest::Approx(std::lgamma(-x)).epsilon(eps), spook::lgamma(-x));
+		}
+
+		for (double x : { 1.0E8, 1.0E17, 1.0E300 }) {
+			CHECK_EQ(doctest::Approx(std::lgamma(x)).epsilon(eps), spook::lgamma(x));
+		}
+
+		//整数では階乗に一致する
+		double factorial = 1.0;
+		for (int n = 1; n <= 23; ++n) {
+			CHECK_EQ(factorial, spook::tgamma(double(n)));
+			factorial *= n;
+		}
+
+		//零点
+		CHECK_EQ(0.0, spook::lgamma(1.0));
+		CHECK_EQ(0.0, spook::lgamma(2.0));
+
+		CHECK_EQ(doctest::Approx(std::tgamma(4.5f)).epsilon(1.0E-6), spook::tgamma(4.5f));
+		CHECK_EQ(doctest::Approx(std::lgamma(-2.5f)).epsilon(1.0E-6), spook::lgamma(-2.5f));
+		CHECK_EQ(doctest::Approx(std::tgamma(30.5L)).epsilon(1.0E-18), spook::tgamma(30.5L));
+		CHECK_EQ(doctest::Approx(std::lgamma(1000.2L)).epsilon(1.0E-18), spook::lgamma(1000.2L));
+
+		//特殊な値
+		CHECK_EQ(inf, spook::tgamma(0.0));
+		CHECK_EQ(-inf, spook::tgamma(-0.0));
+		CHECK_EQ(-std::numeric_limits<float>::infinity(), spook::tgamma(-0.0f));
+		CHECK_EQ(-std::numeric_limits<long double>::infinity(), spook::tgamma(-0.0L));
+		static_assert(spook::tgamma(-0.0) == -std::numeric_limits<double>::infinity());
+		CHECK_EQ(inf, spook::tgamma(172.0));
+		CHECK_EQ(inf, spook::tgamma(inf));
+		CHECK_UNARY(spook::isnan(spook::tgamma(-3.0)));
+		CHECK_UNARY(spook::isnan(spook::tgamma(-inf)));
+		CHECK_EQ(inf, spook::lgamma(0.0));
+		CHECK_EQ(inf, spook::lgamma(-3.0));
+		CHECK_EQ(inf, spook::lgamma(-inf));
+		CHECK_EQ(inf, spook::lgamma((std::numeric_limits<double>::max)()));
+
+		{
+			constexpr auto calc = spook::tgamma(5.5);
+			CHECK_EQ(doctest::Approx(std::tgamma(5.5)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::tgamma(-2.5);
+			CHECK_EQ(doctest::Approx(std::tgamma(-2.5)).epsilon(eps), calc);
+		}
+
+		{
+			constexpr auto calc = spook::lgamma(0.3);
+			CHECK_EQ(doctest::Approx(std::lgamma(0.3)).epsilon(eps), calc);
+		}
+	}
+
+	TEST_CASE("accuracy policy test") {
+		//fast_tは単精度相当
+		constexpr double fast_eps = 1.0E-7;
+
+		{
+			constexpr double fast = spook::sin(1.0, spook::fast);
+			constexpr double faithful = spook::sin(1.0, spook::faithful);
+			constexpr double rounded = spook::sin(1.0, spook::correctly_rounded);
+
+			CHECK_EQ(doctest::Approx(std::sin(1.0)).epsilon(fast_eps), fast);
+			CHECK_EQ(spook::sin(1.0), faithful);
+			CHECK_EQ(0.8414709848078965, rounded);
+		}
+		{
+			constexpr double fast = spook::cos(1.0e22, spook::fast);
+			constexpr double rounded = spook::cos(1.0e22, spook::correctly_rounded);
+
+			CHECK_EQ(doctest::Approx(std::cos(1.0e22)).epsilon(fast_eps), fast);
+			CHECK_EQ(std::cos(1.0e22), rounded);
+		}
+		{
+			const auto [s, c] = spook::sincos(0.5, spook::fast);
+			CHECK_EQ(doctest::Approx(std::sin(0.5)).epsilon(fast_eps), s);
+			CHECK_EQ(doctest::Approx(std::cos(0.5)).epsilon(fast_eps), c);
+			CHECK_EQ(doctest::Approx(std::tan(1.5)).epsilon(fast_eps), spook::tan(1.5, spook::fast));
+			CHECK_EQ(std::tan(0.5), spook::tan(0.5, spook::correctly_rounded));
+		}
+		{
+			constexpr double fast = spook::exp(10.0, spook::fast);
+			constexpr double rounded = spook::exp(1.0, spook::correctly_rounded);
+
+			CHECK_EQ(doctest::Approx(std::exp(10.0)).epsilon(fast_eps), fast);
+			CHECK_EQ(2.718281828459045, rounded);
+			CHECK_EQ(doctest::Approx(std::exp2(0.3)).epsilon(fast_eps), spook::exp2(0.3, spook::fast));
+			CHECK_EQ(doctest::Approx(std::pow(10.0, 0.3)).epsilon(fast_eps), spook::exp10(0.3, spook::fast));
+			CHECK_EQ(1024.0, spook::exp2(10.0, spook::correctly_rounded));
+			CHECK_EQ(1000.0, spook::exp10(3.0, spook::correctly_rounded));
+		}
+		{
+			constexpr double fast = spook::log(10.0, spook::fast);
+			constexpr double rounded = spook::log(10.0, spook::correctly_rounded);
+
+			CHECK_EQ(doctest::Approx(std::log(10.0)).epsilon(fast_eps), fast);
+			CHECK_EQ(2.302585092994046, rounded);
+			CHECK_EQ(doctest::Approx(std::log2(3.0)).epsilon(fast_eps), spook::log2(3.0, spook::fast));
+			CHECK_EQ(doctest::Approx(std::log10(3.0)).epsilon(fast_eps), spook::log10(3.0, spook::fast));
+			CHECK_EQ(10.0, spook::log2(1024.0, spook::correctly_rounded));
+			CHECK_EQ(3.0, spook::log10(1000.0, spook::correctly_rounded));
+		}
+		{
+			constexpr double fast = spook::pow(2.0, 0.5, spook::fast);
+			constexpr double rounded = spook::pow(2.0, 0.5, spook::correctly_rounded);
+
+			CHECK_EQ(doctest::Approx(std::sqrt(2.0)).epsilon(fast_eps), fast);
+			CHECK_EQ(std::sqrt(2.0), rounded);
+			CHECK_EQ(std::pow(1.1, 50), spook::pow(1.1, 50, spook::correctly_rounded));
+		}
+		{
+			constexpr double fast = spook::sqrt(2.0, spook::fast);
+
+			CHECK_EQ(doctest::Approx(std::sqrt(2.0)).epsilon(fast_eps), fast);
+			CHECK_EQ(std::sqrt(2.0), spook::sqrt(2.0, spook::correctly_rounded));
+			CHECK_EQ(doctest::Approx(1.0 / std::sqrt(3.0)).epsilon(fast_eps), spook::rsqrt(3.0, spook::fast));
+			CHECK_EQ(doctest::Approx(std::cbrt(3.0)).epsilon(fast_eps), spook::cbrt(3.0, spook::fast));
+			CHECK_EQ(0.5, spook::rsqrt(4.0, spook::correctly_rounded));
+			CHECK_EQ(3.0, spook::cbrt(27.0, spook::correctly_rounded));
+		}
+		{
+			//floatはdoubleで計算して丸める
+			constexpr float rounded = spook::exp(0.5f, spook::correctly_rounded);
+			CHECK_EQ(std::exp(0.5f), rounded);
+			CHECK_EQ(std::sin(3.0f), spook::sin(3.0f, spook::correctly_rounded));
+
+			//doubleでの値がfloatの丸めの境界に近く、dd<double>で計算し直すもの（真の値は0x1.a35bc30000002708p-3で、中点0x1.a35bc3p-3の僅かに上）
+			constexpr float near_midpoint = spook::sin(0x1.515766p+12f, spook::correctly_rounded);
+			CHECK_EQ(0x1.a35bc4p-3f, near_midpoint);
+			CHECK_EQ(0x1.a35bc4p-3f, spook::sin(0x1.515766p+12f, spook::correctly_rounded));
+		}
+		{
+			//dd<double>の級数は固定次数なので、256点の表も既定の演算回数の上限に収まる
+			constexpr auto table = spook::make_table<256>([](double x) { return spook::exp(x, spook::correctly_rounded); }, -1.0, 1.0);
+
+			CHECK_EQ(std::exp(-1.0), table[0]);
+			CHECK_EQ(std::exp(1.0), table[255]);
+		}
+
+		//特別な値は方針に依らない
+		CHECK_UNARY(spook::isnan(spook::sin(std::numeric_limits<double>::infinity(), spook::correctly_rounded)));
+		CHECK_EQ(0.0, spook::exp(-std::numeric_limits<double>::infinity(), spook::fast));
+		CHECK_EQ(-std::numeric_limits<double>::infinity(), spook::log(0.0, spook::correctly_rounded));
+		CHECK_UNARY(spook::isnan(spook::sqrt(-1.0, spook::fast)));
+	}
+
+	TEST_CASE("runtime dispatch test") {
+		//volatileを経由して実行時に計算させ、定数式での結果と比べる
+		volatile double input = 2.0;
+		const double x = input;
+		input = -2.5;
+		const double y = input;
+
+		{
+			constexpr double calc = spook::sqrt(2.0);
+			constexpr double fast = spook::sqrt(2.0, spook::fast);
+			CHECK_EQ(calc, spook::sqrt(x));
+			CHECK_EQ(fast, spook::sqrt(x, spook::fast));
+
+			//fast_tは実行時も同じ反復を使うので、丸めの境界を調べない分の誤差まで定数式と一致する
+			static constexpr std::array<double, 5> inputs = { 3.0, 0.1, 1.0E-310, 7.0E300, 1234.5678 };
+			constexpr auto fast_results = [] {
+				std::array<double, 5> r{};
+				for (std::size_t i = 0; i < r.size(); ++i) r[i] = spook::sqrt(inputs[i], spook::fast);
+				return r;
+			}();
+
+			for (std::size_t i = 0; i < inputs.size(); ++i) {
+				volatile double v = inputs[i];
+				CHECK_EQ(fast_results[i], spook::sqrt(double(v), spook::fast));
+			}
+		}
+		{
+			constexpr double f = spook::floor(-2.5);
+			constexpr double c = spook::ceil(-2.5);
+			constexpr double t = spook::trunc(-2.5);
+
+			CHECK_EQ(f, spook::floor(y));
+			CHECK_EQ(c, spook::ceil(y));
+			CHECK_EQ(t, spook::trunc(y));
+			CHECK_EQ(2.5, spook::fabs(y));
+		}
+		{
+			constexpr double m = spook::fmod(-2.5, 2.0);
+			constexpr double r = spook::remainder(-2.5, 2.0);
+
+			CHECK_EQ(m, spook::fmod(y, x));
+			CHECK_EQ(r, spook::remainder(y, x));
+		}
+		{
+			int e = 0;
+			const double m = spook::frexp(y, &e);
+
+			CHECK_EQ(-0.625, m);
+			CHECK_EQ(2, e);
+			CHECK_EQ(spook::ilogb(-2.5), spook::ilogb(y));
+			CHECK_EQ(spook::logb(-2.5), spook::logb(y));
+			CHECK_EQ(std::numeric_limits<double>::denorm_min(), spook::ldexp(x, -1075));
+			CHECK_EQ(std::nextafter(2.0, 3.0), spook::nextafter(x, 3.0));
+		}
+		{
+			//超越関数は実行時も同じカーネルを使うので、定数式の結果と一致する
+			constexpr double s = spook::sin(2.0);
+			constexpr double l = spook::log(2.0);
+			constexpr double p = spook::pow(2.0, -2.5);
+
+			CHECK_EQ(s, spook::sin(x));
+			CHECK_EQ(l, spook::log(x));
+			CHECK_EQ(p, spook::pow(x, y));
+		}
+	}
+
+#if defined(__cpp_lib_span) && defined(__cpp_lib_bit_cast)
+
+	template<typename T>
+	void check_batch_results(const std::vector<T>& expected, const std::vector<T>& calc) {
+		constexpr T eps = std::numeric_limits<T>::epsilon() * 4;
+
+		CHECK_EQ(expected.size(), calc.size());
+
+		for (std::size_t i = 0; i < expected.size(); ++i) {
+			if (std::isnan(expected[i])) {
+				CHECK_UNARY(std::isnan(calc[i]));
+			} else if (expected[i] == calc[i] || std::isinf(expected[i]) || expected[i] == T(0.0)) {
+				CHECK_EQ(expected[i], calc[i]);
+			} else {
+				//FMA化された場合の丸め誤差のみ許す
+				CHECK_EQ(doctest::Approx(expected[i]).epsilon(eps), calc[i]);
+			}
+		}
+	}
+
+	template<typename T>
+	void check_batch() {
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+		//ブロックの端数と、ベクトル化されない特別な値を混ぜる
+		std::vector<T> x = { T(0.0), T(-0.0), T(0.5), T(-0.5), T(1.0), T(2.0), T(-2.5), T(3.0), T(10.0), T(-10.0), T(100.0), T(-100.0), T(1.0E6), inf, -inf, nan, (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min(), (std::numeric_limits<T>::max)() };
+		for (int i = 0; i < 40; ++i) {
+			x.push_back(T(-20.0) + T(i) * T(1.03));
+		}
+		std::vector<T> y(x.rbegin(), x.rend());
+
+		const auto run = [&](auto batch, auto scalar) {
+			std::vector<T> expected(x.size()), calc(x.size());
+
+			for (std::size_t i = 0; i < x.size(); ++i) {
+				expected[i] = scalar(x[i], y[i]);
+			}
+			batch(std::span<const T>(x), std::span<T>(calc));
+			check_batch_results(expected, calc);
+		};
+
+		run([](auto in, auto out) { spook::batch::sin<T>(in, out); }, [](T v, T) { return spook::sin(v); });
+		run([](auto in, auto out) { spook::batch::cos<T>(in, out); }, [](T v, T) { return spook::cos(v); });
+		run([](auto in, auto out) { spook::batch::exp<T>(in, out); }, [](T v, T) { return spook::exp(v); });
+		run([](auto in, auto out) { spook::batch::log<T>(in, out); }, [](T v, T) { return spook::log(v); });
+		run([](auto in, auto out) { spook::batch::sqrt<T>(in, out); }, [](T v, T) { return spook::sqrt(v); });
+		run([&](auto in, auto out) { spook::batch::pow<T>(in, y, out); }, [](T v, T w) { return spook::pow(v, w); });
+		run([&](auto in, auto out) { spook::batch::atan2<T>(y, in, out); }, [](T v, T w) { return spook::atan2(w, v); });
+
+		{
+			//入力と出力が同じ領域
+			std::vector<T> expected(x.size());
+			std::transform(x.begin(), x.end(), expected.begin(), [](T v) { return spook::exp(v); });
+
+			std::vector<T> inout = x;
+			spook::batch::exp<T>(inout, inout);
+			check_batch_results(expected, inout);
+		}
+		{
+			//出力が短い時は短い方まで
+			std::vector<T> out(5, T(-1.0));
+			spook::batch::sin<T>(std::span<const T>(x).first(3), out);
+
+			CHECK_EQ(spook::sin(x[2]), out[2]);
+			CHECK_EQ(T(-1.0), out[3]);
+		}
+	}
+
+	TEST_CASE("batch test") {
+		CHECK_UNARY(1 <= spook::batch::simd_width<double>);
+		CHECK_EQ(spook::batch::simd_width<double> * 2, spook::batch::simd_width<float>);
+
+		check_batch<float>();
+		check_batch<double>();
+		check_batch<long double>();
+	}
+
+#endif // __cpp_lib_span
+
+#if defined(__GNUC__) && defined(__cpp_lib_bit_cast)
+
+	template<typename T>
+	void check_simd() {
+		using simd = spook::simd<T>;
+		constexpr std::size_t N = simd::size();
+		constexpr T inf = std::numeric_limits<T>::infinity();
+		constexpr T nan = std::numeric_limits<T>::quiet_NaN();
+
+		const std::vector<T> values = { T(0.0), T(-0.0), T(0.5), T(-2.5), T(3.0), T(10.0), T(-100.0), T(1.0E6), inf, -inf, nan, (std::numeric_limits<T>::min)(), std::numeric_limits<T>::denorm_min(), T(88.0), T(-90.0), T(0.75) };
+
+		for (std::size_t first = 0; first < values.size(); first += N) {
+			T in[N] = {};
+			T in2[N] = {};
+			for (std::size_t i = 0; i < N; ++i) {
+				in[i] = values[(first + i) % values.size()];
+				in2[i] = values[(first + i + 3) % values.size()];
+			}
+
+			const simd x = simd::load(in);
+			const simd y = simd::load(in2);
+
+			const simd results[] = { spook::sin(x), spook::cos(x), spook::exp(x), spook::log(x), spook::sqrt(x), spook::pow(x, y), spook::atan2(x, y), spook::fabs(x), spook::copysign(x, y) };
+
+			for (std::size_t i = 0; i < N; ++i) {
+				const T expected[] = { spook::sin(in[i]), spook::cos(in[i]), spook::exp(in[i]), spook::log(in[i]), spook::sqrt(in[i]), spook::pow(in[i], in2[i]), spook::atan2(in[i], in2[i]), std::fabs(in[i]), std::copysign(in[i], in2[i]) };
+
+				for (std::size_t k = 0; k < std::size(expected); ++k) {
+					if (std::isnan(expected[k])) {
+						CHECK_UNARY(std::isnan(results[k][i]));
+					} else if (expected[k] == results[k][i] || std::isinf(expected[k]) || expected[k] == T(0.0)) {
+						CHECK_EQ(expected[k], results[k][i]);
+					} else {
+						//FMA化された場合の丸め誤差のみ許す
+						CHECK_EQ(doctest::Approx(expected[k]).epsilon(std::numeric_limits<T>::epsilon() * 4), results[k][i]);
+					}
+				}
+
+				//分類はマスクで返る
+				CHECK_EQ(bool(std::isnan(in[i])), spook::isnan(x)[i]);
+				CHECK_EQ(bool(std::isinf(in[i])), spook::isinf(x)[i]);
+				CHECK_EQ(bool(std::isfinite(in[i])), spook::isfinite(x)[i]);
+				CHECK_EQ(bool(std::signbit(in[i])), spook::signbit(x)[i]);
+				CHECK_EQ(in[i] == T(0.0), spook::iszero(x)[i]);
+			}
+
+			//マスクによる選択
+			const auto special = (!spook::isfinite(x)) | spook::iszero(x);
+			const simd sanitized = spook::select(special, simd(T(1.0)), x);
+			for (std::size_t i = 0; i < N; ++i) {
+				CHECK_EQ(special[i] ? T(1.0) : in[i], sanitized[i]);
+			}
+			CHECK_EQ(spook::any(special), !spook::none(special));
+		}
+
+		const simd a(T(1.5));
+		const simd b(T(0.5));
+		CHECK_UNARY(spook::all((a + b) == simd(T(2.0))));
+		CHECK_UNARY(spook::all((a * b) == simd(T(0.75))));
+		CHECK_UNARY(spook::all((a / b) == simd(T(3.0))));
+		CHECK_UNARY(spook::none(a < b));
+	}
+
+	TEST_CASE("simd test") {
+		check_simd<float>();
+		check_simd<double>();
+	}
+
+#endif // __GNUC__
+
+	template<typename T, std::size_t N, typename F>
+	void check_table(const std::array<T, N>& table, T lo, T hi, F f) {
+		const T step = (hi - lo) / T(N - 1);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			//標本点lo + i * stepは丸めずに評価される
+			const long double x = static_cast<long double>(lo) + static_cast<long double>(step) * static_cast<long double>(i);
+			const long double expected = f(x);
+			const long double ulp = std::numeric_limits<T>::epsilon() * std::max(std::fabs(expected), static_cast<long double>((std::numeric_limits<T>::min)()));
+
+			//値は最後に1回だけ丸めるので、丸めない標本点での真の値との差は1ulp未満
+			CHECK_UNARY(std::fabs(table[i] - expected) < ulp);
+		}
+	}
+
+	TEST_CASE("make_table test") {
+		constexpr std::size_t N = 600;
+
+		constexpr auto sin_d = spook::make_table<N>(spook::sin<double>, -10.0, 20.0);
+		constexpr auto cos_d = spook::make_table<N>(spook::cos<double>, 0.0, 100.0);
+		constexpr auto exp_d = spook::make_table<N>(spook::exp<double>, -30.0, 5.0);
+		constexpr auto sin_f = spook::make_table<N>(spook::sin<float>, -3.5f, 3.5f);
+		constexpr auto exp_f = spook::make_table<N>(spook::exp<float>, -10.0f, 10.0f);
+
+		const auto sin_l = [](long double x) { return std::sin(x); };
+		const auto cos_l = [](long double x) { return std::cos(x); };
+		const auto exp_l = [](long double x) { return std::exp(x); };
+
+		check_table(sin_d, -10.0, 20.0, sin_l);
+		check_table(cos_d, 0.0, 100.0, cos_l);
+		check_table(exp_d, -30.0, 5.0, exp_l);
+		check_table(sin_f, -3.5f, 3.5f, sin_l);
+		check_table(exp_f, -10.0f, 10.0f, exp_l);
+
+		//その他の関数は各標本点で評価する
+		constexpr auto sqrt_d = spook::make_table<N>(spook::sqrt<double>, 0.0, 50.0);
+		constexpr auto square = spook::make_table<5>([](double x) { return x * x; }, -1.0, 1.0);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			CHECK_EQ(spook::sqrt(0.0 + 50.0 / double(N - 1) * double(i)), sqrt_d[i]);
+		}
+
+		CHECK_EQ(1.0, square[0]);
+		CHECK_EQ(0.25, square[1]);
+		CHECK_EQ(0.0, square[2]);
+		CHECK_EQ(0.25, square[3]);
+		CHECK_EQ(1.0, square[4]);
+
+		//1点なら端点のみ
+		constexpr auto single = spook::make_table<1>(spook::exp<double>, 0.0, 1.0);
+		CHECK_EQ(1.0, single[0]);
+	}
+
+	template<typename TF, typename F>
+	void check_table_function(const TF& f, double lo, double hi, F exact) {
+		constexpr int n = 1000;
+
+		for (int i = 0; i <= n; ++i) {
+			const double x = lo + (hi - lo) * i / n;
+
+			CHECK_UNARY(std::fabs(f(x) - exact(x)) <= f.error_bound());
+		}
+	}
+
+	TEST_CASE("table_function test") {
+		constexpr double pi = spook::pi<double>;
+
+		constexpr spook::table_function<spook::sin<double>, 256> sin_linear(0.0, 2.0 * pi);
+		constexpr spook::table_function<spook::sin<double>, 256, spook::quadratic_t> sin_quadratic(0.0, 2.0 * pi);
+		constexpr spook::table_function<spook::sin<double>, 256, spook::cubic_hermite_t> sin_cubic(0.0, 2.0 * pi);
+		constexpr spook::table_function<spook::exp<double>, 128, spook::cubic_hermite_t> exp_cubic(-5.0, 5.0);
+		constexpr spook::table_function<[](double x) { return spook::atan(x); }, 512, spook::cubic_hermite_t> atan_cubic(-8.0, 8.0);
+
+		//刻み幅hに対して、誤差はそれぞれO(h^2), O(h^3), O(h^4)
+		static_assert(sin_linear.error_bound() < 2.0E-4);
+		static_assert(sin_quadratic.error_bound() < 3.0E-6);
+		static_assert(sin_cubic.error_bound() < 3.0E-9);
+		static_assert(exp_cubic.error_bound() < 1.0E-4);
+		static_assert(atan_cubic.error_bound() < 1.0E-7);
+		static_assert(sin_cubic.error_bound() < sin_quadratic.error_bound() && sin_quadratic.error_bound() < sin_linear.error_bound());
+
+		//上界は標本点での誤差以上で、過大になりすぎない
+		static_assert(sin_linear.sampled_error() <= sin_linear.error_bound() && sin_linear.error_bound() < 8.0 * sin_linear.sampled_error());
+		static_assert(sin_cubic.sampled_error() <= sin_cubic.error_bound() && sin_cubic.error_bound() < 8.0 * sin_cubic.sampled_error());
+		static_assert(atan_cubic.sampled_error() <= atan_cubic.error_bound() && atan_cubic.error_bound() < 8.0 * atan_cubic.sampled_error());
+
+		check_table_function(sin_linear, 0.0, 2.0 * pi, [](double x) { return std::sin(x); });
+		check_table_function(sin_quadratic, 0.0, 2.0 * pi, [](double x) { return std::sin(x); });
+		check_table_function(sin_cubic, 0.0, 2.0 * pi, [](double x) { return std::sin(x); });
+		check_table_function(exp_cubic, -5.0, 5.0, [](double x) { return std::exp(x); });
+		check_table_function(atan_cubic, -8.0, 8.0, [](double x) { return std::atan(x); });
+
+		//表の点では表の値そのもの
+		constexpr spook::table_function<[](double x) { return x * x * x; }, 5> cube(0.0, 4.0);
+		CHECK_EQ(0.0, cube(0.0));
+		CHECK_EQ(1.0, cube(1.0));
+		CHECK_EQ(8.0, cube(2.0));
+		CHECK_EQ(27.0, cube(3.0));
+		CHECK_EQ(64.0, cube(4.0));
+		CHECK_EQ(4.5, cube(1.5));
+
+		//範囲外は端の区間から外挿し、NaNはNaNになる
+		CHECK_EQ(-1.0, cube(-1.0));
+		CHECK_UNARY(std::isnan(sin_cubic(std::numeric_limits<double>::quiet_NaN())));
+	}
+
+	template<typename T, std::size_t N>
+	auto evaluate_monomial(const std::array<T, N>& c, double x) -> double {
+		double result = 0.0;
+		for (std::size_t k = N; 0 < k; --k) result = result * x + double(c[k - 1]);
+		return result;
+	}
+
+	template<typename T, std::size_t N, typename F>
+	auto fit_error(const std::array<T, N>& c, double a, double b, F f) -> double {
+		double error = 0.0;
+		for (int i = 0; i <= 10000; ++i) {
+			const double x = a + (b - a) * i / 10000;
+			error = std::max(error, std::fabs(evaluate_monomial(c, x) - f(x)));
+		}
+		return error;
+	}
+
+	TEST_CASE("polynomial fit test") {
+		constexpr double eps = 1.0E-12;
+
+		//x^4の3次の最良近似はx^4 - T_4(x) / 8 = x^2 - 1/8で、これはT_4の零点での補間とも一致する
+		constexpr auto minimax_x4 = spook::minimax_fit<3>([](double x) { return x * x * x * x; }, -1.0, 1.0);
+		constexpr auto chebyshev_x4 = spook::chebyshev_fit<3>([](double x) { return x * x * x * x; }, -1.0, 1.0);
+
+		for (const auto& c : { minimax_x4, chebyshev_x4 }) {
+			CHECK_EQ(doctest::Approx(-0.125).epsilon(eps), c[0]);
+			CHECK_EQ(doctest::Approx(0.0).epsilon(eps), c[1]);
+			CHECK_EQ(doctest::Approx(1.0).epsilon(eps), c[2]);
+			CHECK_EQ(doctest::Approx(0.0).epsilon(eps), c[3]);
+		}
+
+		constexpr double ln2 = 0.69314718055994530942;
+		constexpr auto minimax_exp = spook::minimax_fit<5>(spook::exp<double>, 0.0, ln2);
+		constexpr auto chebyshev_exp = spook::chebyshev_fit<5>(spook::exp<double>, 0.0, ln2);
+		const auto exp = [](double x) { return std::exp(x); };
+
+		const double minimax_error = fit_error(minimax_exp, 0.0, ln2, exp);
+		CHECK_UNARY(minimax_error < 1.1E-7);
+		CHECK_UNARY(minimax_error < fit_error(chebyshev_exp, 0.0, ln2, exp));
+
+		//最良近似の誤差は両端を含むDegree + 2点で同じ大きさになる
+		CHECK_EQ(doctest::Approx(minimax_error).epsilon(0.01), std::fabs(evaluate_monomial(minimax_exp, 0.0) - 1.0));
+		CHECK_EQ(doctest::Approx(minimax_error).epsilon(0.01), std::fabs(evaluate_monomial(minimax_exp, ln2) - 2.0));
+
+		constexpr auto minimax_log = spook::minimax_fit<4>(spook::log<double>, 1.0, 2.0);
+		constexpr auto chebyshev_log = spook::chebyshev_fit<4>(spook::log<double>, 1.0, 2.0);
+		const auto log = [](double x) { return std::log(x); };
+
+		CHECK_UNARY(fit_error(minimax_log, 1.0, 2.0, log) < 6.1E-5);
+		CHECK_UNARY(fit_error(minimax_log, 1.0, 2.0, log) < fit_error(chebyshev_log, 1.0, 2.0, log));
+
+		//floatの係数もdoubleで計算して丸める
+		constexpr auto minimax_sin_f = spook::minimax_fit<5>(spook::sin<float>, -1.0f, 1.0f);
+		CHECK_UNARY(fit_error(minimax_sin_f, -1.0, 1.0, [](double x) { return std::sin(x); }) < 1.0E-5);
+
+		//誤差が丸め誤差に埋もれる次数でも発散しない
+		constexpr auto minimax_exp11 = spook::minimax_fit<11>(spook::exp<double>, 0.0, ln2);
+		CHECK_UNARY(fit_error(minimax_exp11, 0.0, ln2, exp) < 1.0E-15);
+	}
+
+	TEST_CASE("polynomial evaluation test") {
+		//整数係数なら丸め誤差は無く、全ての方法で一致する
+		constexpr std::array<double, 4> cubic = { 1.0, 2.0, 3.0, 4.0 };
+		static_assert(spook::horner(cubic, 2.0) == 49.0);
+		static_assert(spook::estrin(cubic, 2.0) == 49.0);
+		static_assert(spook::compensated_horner(cubic, 2.0) == 49.0);
+		static_assert(spook::estrin(std::array<double, 1>{ 5.0 }, 2.0) == 5.0);
+		static_assert(spook::estrin(std::array<double, 7>{ 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 }, 2.0) == 127.0);
+
+		//fitの結果をそのまま評価できる
+		constexpr double ln2 = 0.69314718055994530942;
+		constexpr auto exp_coeffs = spook::minimax_fit<11>(spook::exp<double>, 0.0, ln2);
+		constexpr double exp_half = spook::horner(exp_coeffs, 0.5);
+		CHECK_EQ(doctest::Approx(std::exp(0.5)).epsilon(1.0E-14), exp_half);
+
+		for (int i = 0; i <= 100; ++i) {
+			const double x = ln2 * i / 100;
+			const double h = spook::horner(exp_coeffs, x);
+			CHECK_EQ(doctest::Approx(h).epsilon(4.0E-16), spook::estrin(exp_coeffs, x));
+			CHECK_EQ(doctest::Approx(h).epsilon(4.0E-16), spook::compensated_horner(exp_coeffs, x));
+		}
+
+		//(x - 2)^9を展開した係数、2の近くでは桁落ちで通常のHornerの方法の誤差が大きくなる
+		constexpr std::array<double, 10> ill = { -512.0, 2304.0, -4608.0, 5376.0, -4032.0, 2016.0, -672.0, 144.0, -18.0, 1.0 };
+		double horner_error = 0.0, compensated_error = 0.0;
+
+		for (int i = 1; i <= 20; ++i) {
+			const double x = 2.0 + i / 128.0;
+			const double expected = std::pow(x - 2.0, 9);
+
+			horner_error = std::max(horner_error, std::fabs(spook::horner(ill, x) - expected) / expected);
+			compensated_error = std::max(compensated_error, std::fabs(spook::compensated_horner(ill, x) - expected) / expected);
+		}
+		CHECK_UNARY(compensated_error < 1.0E-15);
+		CHECK_UNARY(compensated_error * 1000.0 < horner_error);
+
+		constexpr std::array<float, 5> poly_f = { 1.0f, -0.5f, 0.25f, -0.125f, 0.0625f };
+		static_assert(spook::compensated_horner(poly_f, 2.0f) == 1.0f);
+
+#if defined(__cpp_lib_span) && defined(__cpp_lib_bit_cast)
+		{
+			std::vector<double> in, out(37), expected(37);
+			for (int i = 0; i < 37; ++i) in.push_back(2.0 + i / 256.0);
+
+			spook::batch::horner(ill, std::span<const double>(in), std::span<double>(out));
+			for (int i = 0; i < 37; ++i) CHECK_EQ(spook::horner(ill, in[i]), out[i]);
+
+			spook::batch::estrin(ill, std::span<const double>(in), std::span<double>(out));
+			for (int i = 0; i < 37; ++i) CHECK_EQ(spook::estrin(ill, in[i]), out[i]);
+
+			spook::batch::compensated_horner(ill, std::span<const double>(in), std::span<double>(out));
+			for (int i = 0; i < 37; ++i) CHECK_EQ(spook::compensated_horner(ill, in[i]), out[i]);
+		}
+#endif // __cpp_lib_span
+
+#if defined(__GNUC__) && defined(__cpp_lib_bit_cast)
+		{
+			using simd = spook::simd<double>;
+			constexpr std::size_t N = simd::size();
+
+			double in[N] = {};
+			for (std::size_t i = 0; i < N; ++i) in[i] = 2.0 + double(i + 1) / 64.0;
+			const simd x = simd::load(in);
+
+			const simd h = spook::horner(ill, x);
+			const simd e = spook::estrin(ill, x);
+			const simd c = spook::compensated_horner(ill, x);
+
+			for (std::size_t i = 0; i < N; ++i) {
+				CHECK_EQ(spook::horner(ill, in[i]), h[i]);
+				CHECK_EQ(spook::estrin(ill, in[i]), e[i]);
+				CHECK_EQ(spook::compensated_horner(ill, in[i]), c[i]);
+			}
+		}
+#endif // __GNUC__
+	}
+
+	template<typename T, std::size_t N>
+	void check_fft() {
+		std::array<std::complex<T>, N> x{};
+		for (std::size_t n = 0; n < N; ++n) {
+			x[n] = { T(std::sin(0.7 * double(n)) + 0.25), T(std::cos(1.3 * double(n * n))) };
+		}
+
+		const auto X = spook::fft(x);
+		const auto y = spook::ifft(X);
+
+		//long doubleで直接計算したDFTと比べる
+		const long double pi = 3.14159265358979323846264338327950288L;
+		long double scale = 0.0L;
+		for (const auto& v : x) scale += std::abs(std::complex<long double>(v));
+
+		const T eps = std::numeric_limits<T>::epsilon() * T(4.0 * (std::log2(double(N)) + 1.0));
+
+		for (std::size_t k = 0; k < N; ++k) {
+			std::complex<long double> expected{};
+			for (std::size_t n = 0; n < N; ++n) {
+				const long double theta = -2.0L * pi * (long double)((k * n) % N) / (long double)N;
+				expected += std::complex<long double>(x[n]) * std::complex<long double>(std::cos(theta), std::sin(theta));
+			}
+
+			CHECK_UNARY(std::abs(std::complex<long double>(X[k]) - expected) <= eps * scale);
+			CHECK_UNARY(std::abs(y[k] - x[k]) <= eps * T(4.0));
+		}
+	}
+
+	TEST_CASE("fft test") {
+		//定数式でも使える
+		constexpr std::array<std::complex<double>, 4> ones = { { { 1.0, 0.0 }, { 1.0, 0.0 }, { 1.0, 0.0 }, { 1.0, 0.0 } } };
+		constexpr auto ones_spectrum = spook::fft(ones);
+		static_assert(ones_spectrum[0] == std::complex<double>(4.0, 0.0));
+		static_assert(ones_spectrum[1] == std::complex<double>(0.0, 0.0));
+		static_assert(ones_spectrum[3] == std::complex<double>(0.0, 0.0));
+		static_assert(spook::ifft(ones_spectrum)[2] == std::complex<double>(1.0, 0.0));
+
+		//インパルスのスペクトルは平坦、x[1] = 1なら回転因子そのもの
+		constexpr auto impulse = [] {
+			std::array<std::complex<double>, 12> x{};
+			x[1] = 1.0;
+			return spook::fft(x);
+		}();
+		for (std::size_t k = 0; k < 12; ++k) {
+			CHECK_EQ(doctest::Approx(1.0).epsilon(1.0E-15), std::abs(impulse[k]));
+		}
+		//対称な回転因子は正確に一致する
+		CHECK_EQ(std::complex<double>(0.0, -1.0), impulse[3]);
+		CHECK_EQ(std::complex<double>(-1.0, 0.0), impulse[6]);
+		CHECK_EQ(impulse[2].real(), -impulse[4].real());
+		CHECK_EQ(impulse[1].real(), -impulse[2].imag());
+
+		constexpr auto kernel = spook::fft(std::array<std::complex<float>, 256>{ { { 0.25f, 0.0f }, { 0.5f, 0.0f }, { 0.25f, 0.0f } } });
+		CHECK_EQ(std::complex<float>(1.0f, 0.0f), kernel[0]);
+		CHECK_EQ(std::complex<float>(0.0f, 0.0f), kernel[128]);
+
+		check_fft<double, 1>();
+		check_fft<double, 2>();
+		check_fft<double, 8>();
+		check_fft<double, 1024>();
+		check_fft<double, 6>();
+		check_fft<double, 7>();
+		check_fft<double, 45>();
+		check_fft<double, 100>();
+		check_fft<double, 1000>();
+		check_fft<float, 64>();
+		check_fft<float, 60>();
+		check_fft<long double, 32>();
+		check_fft<long double, 24>();
+	}
+
 	TEST_CASE("lerp test") {
 		constexpr double start = 0.0;
 		constexpr double end = 10.0;
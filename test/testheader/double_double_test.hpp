@@ -0,0 +1,132 @@
+﻿#include "doctest/doctest.h"
+
+#include "spook.hpp"
+
+namespace spook_test::double_double {
+
+	using dd = spook::dd<double>;
+
+	TEST_CASE("dd arithmetic test") {
+		{
+			constexpr dd third = dd(1.0) / dd(3.0);
+			CHECK_EQ(0.33333333333333331, third.hi);
+			CHECK_EQ(doctest::Approx(1.8503717077085941e-17).epsilon(1.0e-15), third.lo);
+
+			//3倍して1に戻る
+			constexpr dd one = third * 3.0;
+			CHECK_EQ(1.0, one.hi);
+			CHECK_UNARY(spook::abs(one.lo) < 1.0e-32);
+		}
+		{
+			//1 + 2^-60はdoubleでは表せない
+			constexpr dd x = dd(1.0) + 0x1.0p-60;
+			CHECK_EQ(1.0, x.hi);
+			CHECK_EQ(0x1.0p-60, x.lo);
+			CHECK_EQ(0x1.0p-60, (x - 1.0).hi);
+			CHECK_UNARY(dd(1.0) < x);
+			CHECK_UNARY(x != dd(1.0));
+			CHECK_UNARY(-x < dd(-1.0));
+		}
+		{
+			dd x = 2.0;
+			x += 0.5;
+			x *= 4.0;
+			x -= 1.0;
+			x /= 3.0;
+			CHECK_EQ(3.0, x.hi);
+			CHECK_EQ(0.0, x.lo);
+		}
+	}
+
+	TEST_CASE("dd conversion test") {
+		//doubleで表せない64bit整数も保持する
+		constexpr std::int64_t big = (std::int64_t(1) << 60) + 1;
+		constexpr dd x = big;
+		CHECK_EQ(big, static_cast<std::int64_t>(x));
+		CHECK_EQ(big - 1, static_cast<std::int64_t>(x - 1.0));
+		CHECK_EQ(-big, static_cast<std::int64_t>(-x));
+
+		//dd<float>は48bitなので、3つに切り出してから足す
+		{
+			using ddf = spook::dd<float>;
+			constexpr std::int64_t n = 123456789012345;
+			constexpr ddf y = n;
+			CHECK_EQ(n, static_cast<std::int64_t>(y));
+			CHECK_EQ(-n, static_cast<std::int64_t>(ddf(-n)));
+			CHECK_EQ(std::uint64_t(n), static_cast<std::uint64_t>(ddf(std::uint64_t(n))));
+		}
+
+		CHECK_EQ(-2, static_cast<int>(dd(-2.5)));
+		CHECK_EQ(1.5, static_cast<double>(dd(1.5)));
+	}
+
+	TEST_CASE("dd limits test") {
+		using limits = spook::numeric_limits_traits<dd>;
+
+		CHECK_EQ(106, limits::digits);
+		CHECK_EQ(0x1.0p-105, limits::epsilon().hi);
+		CHECK_EQ(std::numeric_limits<double>::max(), limits::max().hi);
+		CHECK_UNARY(spook::isinf(limits::infinity()));
+		CHECK_UNARY(spook::isnan(limits::quiet_NaN()));
+		CHECK_UNARY(spook::is_floating_point_v<dd>);
+	}
+
+	TEST_CASE("dd cmath test") {
+		{
+			const dd r = spook::sqrt(dd(2.0));
+			CHECK_EQ(1.4142135623730951, r.hi);
+			CHECK_EQ(doctest::Approx(-9.6672933134529135e-17).epsilon(1.0e-14), r.lo);
+		}
+		{
+			const dd e = spook::exp(dd(1.0));
+			CHECK_EQ(2.7182818284590451, e.hi);
+			CHECK_EQ(doctest::Approx(1.4456468917292502e-16).epsilon(1.0e-14), e.lo);
+		}
+		{
+			const dd l = spook::log(dd(2.0));
+			CHECK_EQ(0.69314718055994529, l.hi);
+			CHECK_EQ(doctest::Approx(2.3190468138462996e-17).epsilon(1.0e-14), l.lo);
+		}
+		CHECK_UNARY(spook::isnan(spook::sqrt(dd(-1.0))));
+	}
+
+	TEST_CASE("dd special value test") {
+		using limits = spook::numeric_limits_traits<dd>;
+		const dd inf = limits::infinity();
+		const dd nan = limits::quiet_NaN();
+
+		CHECK_EQ(-limits::infinity(), spook::log(dd(0.0)));
+		CHECK_EQ(inf, spook::log(inf));
+		CHECK_UNARY(spook::isnan(spook::log(dd(-1.0))));
+		CHECK_UNARY(spook::isnan(spook::log(nan)));
+		CHECK_EQ(inf, spook::exp(inf));
+		CHECK_EQ(dd(0.0), spook::exp(-inf));
+		CHECK_UNARY(spook::isnan(spook::exp(nan)));
+		CHECK_UNARY(spook::isnan(spook::sin(inf)));
+		CHECK_UNARY(spook::isnan(spook::cos(nan)));
+		CHECK_EQ(inf, spook::sqrt(inf));
+	}
+
+	TEST_CASE("dd trigonometric reduction test") {
+		//値は4倍精度の参照値をhi + loに分けたもの
+		constexpr dd s6 = spook::sin(dd(1.0E6));
+		CHECK_EQ(-0.34999350217129294, s6.hi);
+		CHECK_EQ(doctest::Approx(-1.5952848809323968e-17).epsilon(1.0e-14), s6.lo);
+
+		constexpr dd c12 = spook::cos(dd(1.0E12));
+		CHECK_EQ(0.79144630185289022, c12.hi);
+		CHECK_EQ(doctest::Approx(4.8436223748576778e-17).epsilon(1.0e-14), c12.lo);
+
+		constexpr dd s16 = spook::sin(dd(1.0E16));
+		CHECK_EQ(0.77968800660697879, s16.hi);
+		CHECK_EQ(doctest::Approx(-3.9334422595742607e-17).epsilon(1.0e-14), s16.lo);
+
+		constexpr dd s20 = spook::sin(dd(1.0E20));
+		CHECK_EQ(-0.64525128526578079, s20.hi);
+		CHECK_EQ(doctest::Approx(-5.0185382399526676e-17).epsilon(1.0e-14), s20.lo);
+
+		constexpr dd c20 = spook::cos(dd(-1.0E20));
+		CHECK_EQ(0.76397040444172826, c20.hi);
+		CHECK_EQ(doctest::Approx(4.3494427539578911e-17).epsilon(1.0e-14), c20.lo);
+	}
+}